@@ -0,0 +1,225 @@
+// 天气响应解析基准：流式提取器 vs 原来的realloc缓冲 + cJSON DOM
+//
+// 在Linux主机上编译运行（需要系统的cJSON，例如Debian/Ubuntu的libcjson-dev）：
+//   gcc -O2 -I main -I /usr/include/cjson host/weather_json_bench.c main/weather_json.c -lcjson -o weather_json_bench
+//   ./weather_json_bench host/responses/*.json
+//
+// 按HTTP_EVENT_ON_DATA的方式把每个响应切成chunk字节的数据块喂入，
+// 统计每次解析的平均耗时和峰值堆内存（cJSON路径通过cJSON_InitHooks计数）
+
+#include "weather_json.h"
+#include <cJSON.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_ITERATIONS 20000
+#define DEFAULT_CHUNK      512
+
+// ---------------- 计数分配器 ----------------
+
+static size_t s_heap_now = 0;
+static size_t s_heap_peak = 0;
+static size_t s_alloc_calls = 0;
+
+static void *counted_malloc(size_t size)
+{
+    size_t *p = malloc(sizeof(size_t) + size);
+    if (p == NULL) return NULL;
+    *p = size;
+    s_heap_now += size;
+    s_alloc_calls++;
+    if (s_heap_now > s_heap_peak) s_heap_peak = s_heap_now;
+    return p + 1;
+}
+
+static void counted_free(void *ptr)
+{
+    if (ptr == NULL) return;
+    size_t *p = (size_t *)ptr - 1;
+    s_heap_now -= *p;
+    free(p);
+}
+
+static void *counted_realloc(void *ptr, size_t size)
+{
+    if (ptr == NULL) return counted_malloc(size);
+    size_t *p = (size_t *)ptr - 1;
+    size_t old = *p;
+    size_t *q = realloc(p, sizeof(size_t) + size);
+    if (q == NULL) return NULL;
+    *q = size;
+    s_heap_now = s_heap_now - old + size;
+    s_alloc_calls++;
+    if (s_heap_now > s_heap_peak) s_heap_peak = s_heap_now;
+    return q + 1;
+}
+
+static void reset_heap_stats(void)
+{
+    s_heap_now = 0;
+    s_heap_peak = 0;
+    s_alloc_calls = 0;
+}
+
+// ---------------- 两种解析路径 ----------------
+
+// 原路径：每个数据块realloc扩展缓冲区，结束后cJSON_Parse并查找results[0].now
+static bool parse_cjson(const char *data, size_t len, size_t chunk, weather_now_t *out)
+{
+    char *buffer = NULL;
+    size_t size = 0;
+    size_t length = 0;
+
+    for (size_t off = 0; off < len; off += chunk) {
+        size_t n = len - off < chunk ? len - off : chunk;
+        if (buffer == NULL) {
+            size = n + 1;
+            buffer = counted_malloc(size);
+        } else if (length + n >= size) {
+            size = size + n + 1;
+            buffer = counted_realloc(buffer, size);
+        }
+        memcpy(buffer + length, data + off, n);
+        length += n;
+        buffer[length] = '\0';
+    }
+
+    memset(out, 0, sizeof(*out));
+    bool ok = false;
+    cJSON *root = cJSON_Parse(buffer);
+    if (root != NULL) {
+        cJSON *results = cJSON_GetObjectItem(root, "results");
+        cJSON *result0 = cJSON_IsArray(results) ? cJSON_GetArrayItem(results, 0) : NULL;
+        cJSON *now = result0 ? cJSON_GetObjectItem(result0, "now") : NULL;
+        const char *text = now ? cJSON_GetStringValue(cJSON_GetObjectItem(now, "text")) : NULL;
+        const char *temp = now ? cJSON_GetStringValue(cJSON_GetObjectItem(now, "temperature")) : NULL;
+        const char *code = now ? cJSON_GetStringValue(cJSON_GetObjectItem(now, "code")) : NULL;
+        const char *update = result0 ? cJSON_GetStringValue(cJSON_GetObjectItem(result0, "last_update")) : NULL;
+        const char *status = cJSON_GetStringValue(cJSON_GetObjectItem(root, "status"));
+        if (text) snprintf(out->text, sizeof(out->text), "%s", text);
+        if (temp) snprintf(out->temperature, sizeof(out->temperature), "%s", temp);
+        if (code) snprintf(out->code, sizeof(out->code), "%s", code);
+        if (update) snprintf(out->last_update, sizeof(out->last_update), "%s", update);
+        if (status) snprintf(out->status, sizeof(out->status), "%s", status);
+        ok = text != NULL && temp != NULL;
+        cJSON_Delete(root);
+    }
+    counted_free(buffer);
+    return ok;
+}
+
+static bool parse_stream(const char *data, size_t len, size_t chunk, weather_now_t *out)
+{
+    weather_json_parser_t parser;
+    weather_json_init(&parser, out);
+    for (size_t off = 0; off < len; off += chunk) {
+        size_t n = len - off < chunk ? len - off : chunk;
+        weather_json_feed(&parser, data + off, n);
+    }
+    return weather_json_finish(&parser);
+}
+
+// ---------------- 驱动 ----------------
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = malloc(size + 1);
+    if (data && fread(data, 1, size, f) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    if (data) {
+        data[size] = '\0';
+        *len = size;
+    }
+    return data;
+}
+
+static bool same_fields(const weather_now_t *a, const weather_now_t *b)
+{
+    return strcmp(a->text, b->text) == 0 && strcmp(a->temperature, b->temperature) == 0 &&
+           strcmp(a->code, b->code) == 0 && strcmp(a->last_update, b->last_update) == 0 &&
+           strcmp(a->status, b->status) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = DEFAULT_ITERATIONS;
+    size_t chunk = DEFAULT_CHUNK;
+    int first = 1;
+
+    while (first < argc && argv[first][0] == '-') {
+        if (strcmp(argv[first], "-n") == 0 && first + 1 < argc) {
+            iterations = atoi(argv[first + 1]);
+        } else if (strcmp(argv[first], "-c") == 0 && first + 1 < argc) {
+            chunk = (size_t)atoi(argv[first + 1]);
+        } else {
+            break;
+        }
+        first += 2;
+    }
+    if (first >= argc || iterations <= 0 || chunk == 0) {
+        fprintf(stderr, "usage: %s [-n iterations] [-c chunk_bytes] response.json...\n", argv[0]);
+        return 2;
+    }
+
+    cJSON_Hooks hooks = { .malloc_fn = counted_malloc, .free_fn = counted_free };
+    cJSON_InitHooks(&hooks);
+
+    printf("%d iterations, %zu-byte chunks, streaming parser state %zu bytes (stack, no heap)\n\n",
+           iterations, chunk, sizeof(weather_json_parser_t) + sizeof(weather_now_t));
+    printf("%-28s %6s | %10s %10s %8s | %10s %10s | %s\n", "response", "bytes",
+           "cjson ns", "peak heap", "allocs", "stream ns", "peak heap", "fields");
+
+    int mismatches = 0;
+    for (int f = first; f < argc; f++) {
+        size_t len = 0;
+        char *data = read_file(argv[f], &len);
+        if (data == NULL) {
+            fprintf(stderr, "cannot read %s\n", argv[f]);
+            return 1;
+        }
+
+        weather_now_t a, b;
+        reset_heap_stats();
+        bool ok_a = parse_cjson(data, len, chunk, &a);
+        size_t cjson_peak = s_heap_peak;
+        size_t cjson_allocs = s_alloc_calls;
+        bool ok_b = parse_stream(data, len, chunk, &b);
+        bool match = ok_a == ok_b && same_fields(&a, &b);
+        if (!match) mismatches++;
+
+        double t0 = now_ns();
+        for (int i = 0; i < iterations; i++) {
+            parse_cjson(data, len, chunk, &a);
+        }
+        double t1 = now_ns();
+        for (int i = 0; i < iterations; i++) {
+            parse_stream(data, len, chunk, &b);
+        }
+        double t2 = now_ns();
+
+        const char *name = strrchr(argv[f], '/') ? strrchr(argv[f], '/') + 1 : argv[f];
+        printf("%-28s %6zu | %10.0f %10zu %8zu | %10.0f %10d | %s\n", name, len,
+               (t1 - t0) / iterations, cjson_peak, cjson_allocs,
+               (t2 - t1) / iterations, 0, match ? "match" : "MISMATCH");
+        free(data);
+    }
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""本地天气API替身服务器，用于在局域网内测试设备上的天气客户端。
+
+用法：
+    python3 host/weather_stub_server.py [--port 8080] [--daily daily.json] [response.json]
+
+设备端用心知天气数据源（CONFIG_WEATHER_PROVIDER_SENIVERSE），编译时把WEATHER_API_BASE指向这台机器，
+例如在main/CMakeLists.txt里加
+    target_compile_definitions(${COMPONENT_LIB} PRIVATE WEATHER_API_BASE="http://192.168.1.10:8080")
+
+/v3/weather/now.json返回response.json，/v3/weather/daily.json返回--daily指定的逐日预报。
+服务器使用HTTP/1.1长连接，每个请求打印所在连接的序号，可以看出客户端是否复用了连接。
+
+响应带ETag和Last-Modified，请求带If-None-Match/If-Modified-Since且匹配时返回304。
+响应文件每次请求时按修改时间重新读取，运行中编辑文件即可模拟数据更新。
+加--no-validators时不发这两个头，用来测试客户端按last_update去重。
+
+--fail模拟服务器故障，用来观察客户端的退避和断路：
+    500    返回HTTP 500
+    close  读完请求后直接断开连接，不回响应
+    hang   不回响应，直到客户端超时
+--fail-count N只让前N个请求失败，之后恢复正常（默认一直失败）。
+
+--latency MS在每个响应前等待MS毫秒，模拟公网往返和服务器处理时间。
+--chunk N用分块传输编码（Transfer-Encoding: chunked）每次发N字节，--chunk-delay MS是块间隔，
+用来测试客户端的增量解析。配合设备上的weatherbench命令比较不同网络条件下取数到上屏的延迟。
+
+--tls HOST用HTTPS服务，HOST是设备访问本机用的地址（写进证书CN）。第一次运行时用openssl
+在host/certs/下生成自签名证书stub_cert.pem，设备端打开CONFIG_WEATHER_TLS_CUSTOM_CA嵌入它，
+WEATHER_API_BASE设为"https://HOST:PORT"。每个连接打印TLS会话是否被恢复。
+"""
+
+import argparse
+import email.utils
+import hashlib
+import http.server
+import itertools
+import os
+import ssl
+import subprocess
+import threading
+import time
+
+DEFAULT_RESPONSE = os.path.join(os.path.dirname(__file__), "responses", "now_cloudy.json")
+DEFAULT_DAILY = os.path.join(os.path.dirname(__file__), "responses", "daily_3days.json")
+CERT_DIR = os.path.join(os.path.dirname(__file__), "certs")
+
+_connection_ids = itertools.count(1)
+
+
+class WeatherHandler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"  # 默认保持连接
+    responses = {
+        "/v3/weather/now.json": DEFAULT_RESPONSE,
+        "/v3/weather/daily.json": DEFAULT_DAILY,
+    }
+    validators = True
+    fail_mode = None
+    fail_remaining = -1  # 小于0表示一直失败
+    fail_lock = threading.Lock()
+    latency = 0.0
+    chunk = 0
+    chunk_delay = 0.0
+
+    def setup(self):
+        super().setup()
+        self.connection_id = next(_connection_ids)
+        self.requests_on_connection = 0
+        if isinstance(self.connection, ssl.SSLSocket):
+            print("[conn %d] TLS %s, session %s" % (self.connection_id, self.connection.version(),
+                  "resumed" if self.connection.session_reused else "full handshake"))
+
+    def do_GET(self):
+        self.requests_on_connection += 1
+        if self.latency > 0:
+            time.sleep(self.latency)
+        if self.should_fail():
+            self.fail()
+            return
+        response_path = self.responses.get(self.path.split("?", 1)[0])
+        if response_path is None:
+            self.send_error(404)
+            return
+
+        mtime = os.stat(response_path).st_mtime
+        with open(response_path, "rb") as f:
+            body = f.read()
+        etag = '"%s"' % hashlib.sha1(body).hexdigest()[:16]
+        last_modified = email.utils.formatdate(mtime, usegmt=True)
+
+        if self.validators and self.not_modified(etag, mtime):
+            self.send_response(304)
+            self.send_header("ETag", etag)
+            self.end_headers()
+            return
+
+        self.send_response(200)
+        self.send_header("Content-Type", "application/json; charset=utf-8")
+        if self.chunk > 0:
+            self.send_header("Transfer-Encoding", "chunked")
+        else:
+            self.send_header("Content-Length", str(len(body)))
+        if self.validators:
+            self.send_header("ETag", etag)
+            self.send_header("Last-Modified", last_modified)
+        self.end_headers()
+        if self.chunk > 0:
+            self.write_chunked(body)
+        else:
+            self.wfile.write(body)
+
+    def write_chunked(self, body):
+        for offset in range(0, len(body), self.chunk):
+            if offset > 0 and self.chunk_delay > 0:
+                time.sleep(self.chunk_delay)
+            part = body[offset:offset + self.chunk]
+            self.wfile.write(b"%x\r\n%s\r\n" % (len(part), part))
+            self.wfile.flush()
+        self.wfile.write(b"0\r\n\r\n")
+
+    def should_fail(self):
+        with self.fail_lock:
+            if self.fail_mode is None or self.fail_remaining == 0:
+                return False
+            if self.fail_remaining > 0:
+                WeatherHandler.fail_remaining -= 1
+            return True
+
+    def fail(self):
+        if self.fail_mode == "500":
+            self.send_error(500, "Simulated failure")
+        elif self.fail_mode == "close":
+            self.log_message("simulated failure: closing connection")
+            self.close_connection = True
+        elif self.fail_mode == "hang":
+            self.log_message("simulated failure: not responding")
+            time.sleep(60)
+            self.close_connection = True
+
+    def not_modified(self, etag, mtime):
+        # If-None-Match优先，没有时才看If-Modified-Since（RFC 9110）
+        if_none_match = self.headers.get("If-None-Match")
+        if if_none_match is not None:
+            return etag in [tag.strip() for tag in if_none_match.split(",")]
+        if_modified_since = self.headers.get("If-Modified-Since")
+        if if_modified_since is not None:
+            try:
+                since = email.utils.parsedate_to_datetime(if_modified_since).timestamp()
+            except (TypeError, ValueError):
+                return False
+            return int(mtime) <= since
+        return False
+
+    def log_message(self, fmt, *args):
+        print("[conn %d, request %d] %s" % (self.connection_id, self.requests_on_connection, fmt % args))
+
+
+def tls_context(host):
+    cert = os.path.join(CERT_DIR, "stub_cert.pem")
+    key = os.path.join(CERT_DIR, "stub_key.pem")
+    if not os.path.exists(cert) or not os.path.exists(key):
+        # 只写CN不写SAN：mbedTLS在没有SAN时按CN比较，IP地址也能直接匹配
+        os.makedirs(CERT_DIR, exist_ok=True)
+        subprocess.run(["openssl", "req", "-x509", "-newkey", "ec", "-pkeyopt", "ec_paramgen_curve:prime256v1",
+                        "-nodes", "-days", "3650", "-subj", "/CN=%s" % host,
+                        "-keyout", key, "-out", cert], check=True)
+        print("Generated %s for CN=%s" % (cert, host))
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    context.load_cert_chain(cert, key)
+    return context
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--no-validators", action="store_true",
+                        help="do not send ETag/Last-Modified and never answer 304")
+    parser.add_argument("--daily", default=DEFAULT_DAILY, help="daily forecast response")
+    parser.add_argument("--fail", choices=["500", "close", "hang"], help="simulate a failing server")
+    parser.add_argument("--fail-count", type=int, default=-1,
+                        help="fail only the first N requests (default: all)")
+    parser.add_argument("--latency", type=int, default=0, metavar="MS", help="delay every response by MS")
+    parser.add_argument("--chunk", type=int, default=0, metavar="N",
+                        help="send bodies with chunked transfer encoding, N bytes per chunk")
+    parser.add_argument("--chunk-delay", type=int, default=0, metavar="MS", help="delay between chunks")
+    parser.add_argument("--tls", metavar="HOST", help="serve HTTPS with a self-signed certificate for HOST")
+    parser.add_argument("response", nargs="?", default=DEFAULT_RESPONSE)
+    args = parser.parse_args()
+
+    WeatherHandler.responses = {
+        "/v3/weather/now.json": args.response,
+        "/v3/weather/daily.json": args.daily,
+    }
+    WeatherHandler.validators = not args.no_validators
+    WeatherHandler.fail_mode = args.fail
+    WeatherHandler.fail_remaining = args.fail_count
+    WeatherHandler.latency = args.latency / 1000.0
+    WeatherHandler.chunk = args.chunk
+    WeatherHandler.chunk_delay = args.chunk_delay / 1000.0
+
+    server = http.server.ThreadingHTTPServer(("", args.port), WeatherHandler)
+    if args.tls:
+        server.socket = tls_context(args.tls).wrap_socket(server.socket, server_side=True)
+    print("Serving %s and %s on port %d" % (args.response, args.daily, args.port))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -7,6 +7,7 @@
 #include "esp_wifi.h"
 #include "esp_event.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
 #include "lwip/err.h"
 #include "lwip/sys.h"
@@ -14,10 +15,25 @@
 #include "lwip/dns.h"
 #include "lwip/netdb.h"
 #include "esp_sntp.h"
+#include "sdkconfig.h"
 
 #include "lcd_driver.h"
 #include "weather.h"
 #include "fonts.h"
+#include "weather_anim.h"
+#include "weather_icons.h"
+#include "lcd_capture.h"
+#include "console_cmds.h"
+#include "lcd_ticker.h"
+#include "clock_sched.h"
+#include "weather_service.h"
+#include "widget.h"
+#include "app_cores.h"
+#include "trace.h"
+#include "time_state.h"
+#include "power_mgmt.h"
+#include "loop_monitor.h"
+#include "dns_cache.h"
 
 static const char *TAG = "TFT_CLOCK";
 
@@ -32,8 +48,12 @@ const char* weekDays[] = {"周日", "周一", "周二", "周三", "周四", "周
 char now_address[16] = "杭州";
 char now_temperature[8] = "";
 char now_weather[32] = "";
-uint32_t lastWeatherUpdate = 0;
-const uint32_t WEATHER_UPDATE_INTERVAL = 300000; // 5分钟
+int now_weather_code = -1;   // 心知天气现象代码，-1表示未知
+bool now_weather_stale = false; // 当前显示的是过期缓存
+static weather_forecast_t now_forecast; // 逐日预报，count为0时预报行留空
+static uint32_t weather_version = 0; // 已显示的天气快照版本
+static bool weather_pending_draw = false; // 新快照还没有完整画到屏幕上
+static time_state_t clock_time;       // 渲染用的本地时间，每秒增量推进
 bool firstRun = true;
 
 // 全局LCD对象
@@ -57,6 +77,7 @@ static text_area_bg_t *date_area = NULL;
 static text_area_bg_t *weather_area = NULL;
 static text_area_bg_t *address_area = NULL;
 static text_area_bg_t *second_area = NULL;
+static text_area_bg_t *forecast_area = NULL;
 
 void init_text_areas(lcd_display_t *lcd) {
     // 小时部分区域
@@ -77,6 +98,9 @@ void init_text_areas(lcd_display_t *lcd) {
     // 秒数区域
     second_area = lcd_init_text_area(lcd, 84, 104, 20, 12);
     
+    // 预报行区域（天气和时间之间）
+    forecast_area = lcd_init_text_area(lcd, 0, 42, 128, 36);
+    
     ESP_LOGI(TAG, "Text areas initialized successfully");
 }
 
@@ -87,11 +111,11 @@ void init_text_areas(lcd_display_t *lcd) {
 static void obtain_time(void);
 static void initialize_sntp(void);
 static void wifi_event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data);
-void show_info_on_image(lcd_display_t *lcd, int hour, int minute, int second, int year, int month, int day, const char* week, const char* address, const char* weather, const char* temperature);
+int show_info_on_image(lcd_display_t *lcd, const time_state_t *time, const char* address, const char* weather, const char* temperature, int weather_code, bool weather_stale, const weather_forecast_t *forecast);
 void check_network_connection(void);
 
 void draw_address(lcd_display_t *lcd, const char* address, int x, int y);
-void draw_weather_info(lcd_display_t *lcd, const char* weather, const char* temperature, int x, int y);
+void draw_weather_info(lcd_display_t *lcd, const char* weather, const char* temperature, int weather_code, bool stale, int x, int y);
 void draw_time_without_seconds(lcd_display_t *lcd, int hour, int minute, int x, int y);
 void draw_seconds(lcd_display_t *lcd, int second, int x, int y);
 void draw_date_and_week(lcd_display_t *lcd, int month, int day, const char* week, int x, int y);
@@ -114,6 +138,9 @@ void time_sync_notification_cb(struct timeval *tv)
     time_sync_notified = true;
     ESP_LOGI(TAG, "Time synchronization notification received");
     
+    // 时间可能发生跳变，整秒调度重新对齐
+    clock_sched_resync();
+    
     // 获取当前时间并显示
     time_t now;
     struct tm timeinfo;
@@ -137,25 +164,17 @@ void check_network_connection(void)
         ESP_LOGW(TAG, "Failed to get WiFi AP info");
     }
     
-    // 尝试DNS解析检查网络连通性 - 检查NTP服务器
-    struct addrinfo hints = {0};
-    struct addrinfo *res;
-    hints.ai_family = AF_INET;
-    hints.ai_socktype = SOCK_STREAM;
-    
-    if (getaddrinfo("pool.ntp.org", NULL, &hints, &res) == 0) {
-        ESP_LOGI(TAG, "DNS resolution successful for pool.ntp.org");
-        freeaddrinfo(res);
-    } else {
-        ESP_LOGW(TAG, "DNS resolution failed for pool.ntp.org");
-    }
-    
-    // 检查天气API服务器
-    if (getaddrinfo("api.seniverse.com", NULL, &hints, &res) == 0) {
-        ESP_LOGI(TAG, "DNS resolution successful for api.seniverse.com");
-        freeaddrinfo(res);
-    } else {
-        ESP_LOGW(TAG, "DNS resolution failed for api.seniverse.com");
+    // 检查NTP服务器和天气API服务器能否解析（走DNS缓存，TTL内不再发DNS请求）
+    // 数据源不走网络时只检查NTP服务器
+    const char *hosts[] = { "pool.ntp.org", weather_api_host() };
+    int host_count = hosts[1] != NULL ? 2 : 1;
+    for (int i = 0; i < host_count; i++) {
+        struct in_addr addr;
+        if (dns_cache_lookup(hosts[i], &addr) == ESP_OK) {
+            ESP_LOGI(TAG, "DNS resolution successful for %s", hosts[i]);
+        } else {
+            ESP_LOGW(TAG, "DNS resolution failed for %s", hosts[i]);
+        }
     }
 }
 
@@ -211,6 +230,7 @@ void initialize_sntp(void)
 
 void obtain_time(void)
 {
+    loop_monitor_busy(LOOP_SUBSYS_SNTP, true);
     initialize_sntp();
 
     // 等待时间同步（最多60秒）
@@ -257,21 +277,18 @@ void obtain_time(void)
         };
         if (settimeofday(&tv, NULL) == 0) {
             ESP_LOGI(TAG, "Default time set successfully");
+            // 时间跳变，调度器重新对齐整秒边界
+            clock_sched_resync();
         } else {
             ESP_LOGE(TAG, "Failed to set default time");
         }
     } else {
         ESP_LOGI(TAG, "SNTP synchronization completed successfully");
         
-        // 同步成功后，立即获取天气信息
-        if (get_weather_info(now_weather, now_temperature, sizeof(now_weather))) {
-            ESP_LOGI(TAG, "Weather info obtained: %s, %s", now_weather, now_temperature);
-        } else {
-            ESP_LOGW(TAG, "Failed to get weather info");
-            strcpy(now_weather, "未知");
-            strcpy(now_temperature, "N/A");
-        }
+        // 同步成功后，请求天气任务立即刷新（结果由渲染循环读取快照）
+        weather_service_request_refresh();
     }
+    loop_monitor_busy(LOOP_SUBSYS_SNTP, false);
 }
 
 // 获取时间的任务函数
@@ -305,11 +322,18 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
         ESP_LOGI(TAG, "Got IP:" IPSTR, IP2STR(&event->ip_info.ip));
         retry_count = 0;
         
-        // 检查网络连通性
-        check_network_connection();
+        // 在网络核心上预解析NTP和天气服务器，事件回调里不做阻塞的DNS查询
+        // （getaddrinfo同时填好lwIP自己的DNS表，SNTP解析服务器名时直接命中）
+        static const char *prefetch_hosts[2];
+        prefetch_hosts[0] = "pool.ntp.org";
+        prefetch_hosts[1] = weather_api_host();
+        dns_cache_prefetch(prefetch_hosts, prefetch_hosts[1] != NULL ? 2 : 1);
+        
+        // 联网后立即获取天气
+        weather_service_request_refresh();
         
         // WiFi连接成功后获取时间（使用任务函数而不是lambda）
-        xTaskCreate(obtain_time_task, "obtain_time_task", 4096, NULL, 5, NULL);
+        xTaskCreatePinnedToCore(obtain_time_task, "obtain_time_task", 4096, NULL, 5, NULL, APP_CORE_NET);
         
         // 清屏并显示主界面
         lcd_fill_screen(&g_lcd, COLOR_BLACK);
@@ -524,135 +548,254 @@ void verify_background_data(text_area_bg_t *area, const char* area_name) {
 //     lcd_set_text_color(lcd, COLOR_WHITE);
 //     lcd_draw_custom_string(lcd, timeX + 6 * 6, timeY + 30, week);
 // }
-void show_info_on_image(lcd_display_t *lcd, 
-                       int hour, int minute, int second, 
-                       int year, int month, int day, 
-                       const char* week, 
-                       const char* address, const char* weather, const char* temperature)
+// 各控件的值：通过widget_submit提交，指纹对整块值计算，提交前先清零保证填充字节一致
+typedef struct {
+    char text[16];
+} address_value_t;
+
+typedef struct {
+    char weather[32];
+    char temperature[8];
+    int code;
+    bool stale;
+} weather_value_t;
+
+typedef struct {
+    char text[4];   // "HH"、"MM"或":SS"
+} digits_value_t;
+
+typedef struct {
+    weather_forecast_t forecast;
+} forecast_value_t;
+
+typedef struct {
+    char date[6];   // "MM/DD"
+    int wday;
+} date_value_t;
+
+// 每个控件两份：[0]绘制用，[1]已提交待取走
+static address_value_t address_value[2];
+static weather_value_t weather_value[2];
+static digits_value_t hour_value[2];
+static digits_value_t minute_value[2];
+static digits_value_t second_value[2];
+static date_value_t date_value[2];
+static forecast_value_t forecast_value[2];
+
+// 每帧绘制时间预算；有控件被顺延时，隔FRAME_FOLLOWUP_MS再补画一帧，不用等到下一秒
+#define FRAME_BUDGET_US   (15 * 1000)
+#define FRAME_FOLLOWUP_MS 20
+
+// ---------------- 控件 ----------------
+
+static void address_render(lcd_display_t *lcd, const widget_t *w)
+{
+    const address_value_t *v = w->value;
+    draw_address(lcd, v->text, 5, 5);
+}
+
+static void weather_render(lcd_display_t *lcd, const widget_t *w)
+{
+    const weather_value_t *v = w->value;
+    
+    // 先停字幕，避免恢复背景后又被旧字幕覆盖
+    lcd_ticker_stop();
+    if (weather_area) lcd_restore_text_area_bg(lcd, weather_area);
+    draw_weather_info(lcd, v->weather, v->temperature, v->code, v->stale, 64, 5);
+    
+    // 记录开机到第一次显示有效天气（缓存或新数据）的时间
+    static bool shown_any = false, shown_fresh = false;
+    bool meaningful = v->code >= 0 || (v->weather[0] != '\0' && strcmp(v->weather, "未知") != 0);
+    if (meaningful && (!shown_any || (!v->stale && !shown_fresh))) {
+        ESP_LOGI(TAG, "Weather on screen %lld ms after boot (%s)", esp_timer_get_time() / 1000,
+                 v->stale ? "stale cache" : "fresh");
+        shown_any = true;
+        shown_fresh = shown_fresh || !v->stale;
+    }
+    
+    // 有动画的图标交给动画播放器（图标槽位背景刚被恢复，需要重绘关键帧）
+    if (v->code >= 0) {
+        weather_anim_set_kind(weather_anim_kind_from_icon(weather_icon_from_code(v->code)));
+        weather_anim_restart();
+    } else {
+        weather_anim_set_kind(WEATHER_ANIM_NONE);
+    }
+}
+
+// 预报行：三列，每列一个图标，下面是"最高/最低"温度
+#define FORECAST_Y         42
+#define FORECAST_COL_WIDTH 42
+
+static void forecast_render(lcd_display_t *lcd, const widget_t *w)
+{
+    const forecast_value_t *v = w->value;
+    
+    lcd_set_font_size(lcd, FONT_SIZE_XSMALL);
+    lcd_set_text_color(lcd, COLOR_WHITE);
+    for (int i = 0; i < v->forecast.count && i < WEATHER_FORECAST_DAYS; i++) {
+        const weather_forecast_day_t *day = &v->forecast.days[i];
+        int x = 1 + i * FORECAST_COL_WIDTH;
+        
+        weather_icon_draw(lcd, weather_icon_from_code(day->code),
+                          x + (FORECAST_COL_WIDTH - WEATHER_ICON_SIZE) / 2, FORECAST_Y);
+        
+        char temp_str[12];
+        snprintf(temp_str, sizeof(temp_str), "%d/%d", day->high, day->low);
+        int text_width = (int)strlen(temp_str) * 6;
+        int text_x = x + (FORECAST_COL_WIDTH - text_width) / 2;
+        lcd_draw_string(lcd, text_x < x ? x : text_x, FORECAST_Y + WEATHER_ICON_SIZE, temp_str);
+    }
+}
+
+static void hour_render(lcd_display_t *lcd, const widget_t *w)
 {
-    // 静态变量保存上一次的值
-    static int last_hour = -1, last_minute = -1, last_second = -1;
-    static int last_year = -1, last_month = -1, last_day = -1;
-    static char last_week[10] = "";
-    static char last_address[16] = "";
-    static char last_weather[32] = "";
-    static char last_temperature[8] = "";
+    const digits_value_t *v = w->value;
     
+    lcd_set_font_size(lcd, FONT_SIZE_LARGE);
+    lcd_set_text_color(lcd, COLOR_WHITE);
+    lcd_draw_string(lcd, 16, 80, v->text);
+    
+    // 冒号在小时和分钟区域之间，不会被背景恢复擦掉，跟小时一起画
+    lcd_draw_string(lcd, 16 + 36, 80, ":");
+}
+
+static void minute_render(lcd_display_t *lcd, const widget_t *w)
+{
+    const digits_value_t *v = w->value;
+    
+    lcd_set_font_size(lcd, FONT_SIZE_LARGE);
+    lcd_set_text_color(lcd, COLOR_WHITE);
+    lcd_draw_string(lcd, 16 + 36 + 16, 80, v->text);
+}
+
+static void second_render(lcd_display_t *lcd, const widget_t *w)
+{
+    const digits_value_t *v = w->value;
+    
+    lcd_set_font_size(lcd, FONT_SIZE_XSMALL);
+    lcd_set_text_color(lcd, COLOR_WHITE);
+    lcd_draw_string(lcd, 16 + 68, 80 + 24, v->text);
+}
+
+static void date_render(lcd_display_t *lcd, const widget_t *w)
+{
+    const date_value_t *v = w->value;
+    
+    // 日期字符串已由time_state预先格式化
+    lcd_set_font_size(lcd, FONT_SIZE_XSMALL);
+    lcd_set_text_color(lcd, COLOR_WHITE);
+    lcd_draw_string(lcd, 16, 80 + 26, v->date);
+    
+    lcd_set_custom_font(lcd, show_custom_font);
+    lcd_set_text_color(lcd, COLOR_WHITE);
+    lcd_draw_custom_string(lcd, 16 + 6 * 6, 80 + 26, weekDays[v->wday]);
+}
+
+#define WIDGET_VALUE(arr) .value = &(arr)[0], .pending = &(arr)[1], .value_size = sizeof((arr)[0])
+
+static widget_t address_widget = {
+    .name = "address", .prio = WIDGET_PRIO_LOW, .region = {5, 5, 60, 16},
+    .render = address_render, WIDGET_VALUE(address_value),
+};
+static widget_t weather_widget = {
+    .name = "weather", .prio = WIDGET_PRIO_LOW, .region = {64, 5, 64, 32},
+    .render = weather_render, WIDGET_VALUE(weather_value),
+};
+static widget_t forecast_widget = {
+    .name = "forecast", .prio = WIDGET_PRIO_LOW, .region = {0, FORECAST_Y, 128, 36},
+    .render = forecast_render, WIDGET_VALUE(forecast_value),
+};
+static widget_t hour_widget = {
+    .name = "hour", .prio = WIDGET_PRIO_HIGH, .region = {16, 80, 36, 24},
+    .render = hour_render, WIDGET_VALUE(hour_value),
+};
+static widget_t minute_widget = {
+    .name = "minute", .prio = WIDGET_PRIO_HIGH, .region = {68, 80, 36, 24},
+    .render = minute_render, WIDGET_VALUE(minute_value),
+};
+static widget_t second_widget = {
+    .name = "second", .prio = WIDGET_PRIO_HIGH, .region = {84, 104, 20, 12},
+    .render = second_render, WIDGET_VALUE(second_value),
+};
+static widget_t date_widget = {
+    .name = "date", .prio = WIDGET_PRIO_NORMAL, .region = {16, 106, 60, 12},
+    .render = date_render, WIDGET_VALUE(date_value),
+};
+
+// 注册所有控件（背景缓存来自init_text_areas）
+void init_widgets(void)
+{
+    address_widget.bg = address_area;
+    weather_widget.bg = NULL; // 天气控件要先停字幕再恢复背景，自己处理
+    hour_widget.bg = hour_area;
+    minute_widget.bg = minute_area;
+    second_widget.bg = second_area;
+    date_widget.bg = date_area;
+    forecast_widget.bg = forecast_area;
+    
+    widget_register(&address_widget);
+    widget_register(&weather_widget);
+    widget_register(&hour_widget);
+    widget_register(&minute_widget);
+    widget_register(&second_widget);
+    widget_register(&date_widget);
+    widget_register(&forecast_widget);
+}
+
+// 返回因帧预算不足顺延到下一帧的控件数
+int show_info_on_image(lcd_display_t *lcd, 
+                       const time_state_t *time,
+                       const char* address, const char* weather, const char* temperature,
+                       int weather_code, bool weather_stale,
+                       const weather_forecast_t *forecast)
+{
     if (lcd == NULL) {
         ESP_LOGE(TAG, "LCD is NULL in show_info_on_image");
-        return;
+        return 0;
     }
     
-    // 检查是否需要全屏刷新（首次运行）
-    bool need_full_refresh = firstRun;
+    // 提交各控件的最新值（同一控件未绘制的旧值被覆盖），是否需要重绘由指纹决定
+    address_value_t address_v = {0};
+    snprintf(address_v.text, sizeof(address_v.text), "%s", address);
+    widget_submit(&address_widget, &address_v);
+    
+    weather_value_t weather_v = { .code = weather_code, .stale = weather_stale };
+    snprintf(weather_v.weather, sizeof(weather_v.weather), "%s", weather);
+    snprintf(weather_v.temperature, sizeof(weather_v.temperature), "%s", temperature);
+    widget_submit(&weather_widget, &weather_v);
+    
+    forecast_value_t forecast_v = {0};
+    if (forecast != NULL) {
+        forecast_v.forecast = *forecast;
+    }
+    widget_submit(&forecast_widget, &forecast_v);
     
-    // 记录哪些部分需要刷新
-    bool refresh_address = false;
-    bool refresh_weather = false;
-    bool refresh_hour = false;
-    bool refresh_minute = false;
-    bool refresh_second = false;
-    bool refresh_date = false;
-    bool refresh_week = false;
+    digits_value_t digits = {0};
+    memcpy(digits.text, time->hh, sizeof(time->hh));
+    widget_submit(&hour_widget, &digits);
+    memcpy(digits.text, time->mm, sizeof(time->mm));
+    widget_submit(&minute_widget, &digits);
+    memcpy(digits.text, time->ss, sizeof(time->ss));
+    widget_submit(&second_widget, &digits);
     
-    if (need_full_refresh) {
-        // 全屏刷新
+    date_value_t date_v = { .wday = time->wday };
+    memcpy(date_v.date, time->date, sizeof(time->date));
+    widget_submit(&date_widget, &date_v);
+    
+    // 首次运行：画完整背景，所有控件都要重绘
+    if (firstRun) {
         ESP_LOGI(TAG, "Performing full screen refresh");
         lcd_draw_image(lcd, 0, 0, 128, 128, thunderGod);
-        
+        widget_invalidate_all();
         firstRun = false;
-    } else {
-        // 局部刷新
-        ESP_LOGI(TAG, "Performing partial refresh with background restoration");
-        
-        // 检查地址变化
-        if (strcmp(address, last_address) != 0) {
-            refresh_address = true;
-            strcpy(last_address, address);
-        }
-        
-        // 检查天气变化
-        if (strcmp(weather, last_weather) != 0 || strcmp(temperature, last_temperature) != 0) {
-            refresh_weather = true;
-            strcpy(last_weather, weather);
-            strcpy(last_temperature, temperature);
-        }
-        
-        // 检查时间变化
-        if (hour != last_hour) {
-            refresh_hour = true;
-            last_hour = hour;
-        }
-        
-        if (minute != last_minute) {
-            refresh_minute = true;
-            last_minute = minute;
-        }
-        
-        if (second != last_second) {
-            refresh_second = true;
-            last_second = second;
-        }
-        
-        // 检查日期变化
-        if (year != last_year || month != last_month || day != last_day) {
-            refresh_date = true;
-            last_year = year;
-            last_month = month;
-            last_day = day;
-        }
-        
-        // 检查星期变化
-        if (strcmp(week, last_week) != 0) {
-            refresh_week = true;
-            strcpy(last_week, week);
-        }
-        
-        // 如果没有变化且不是首次运行，直接返回
-        if (!need_full_refresh && !refresh_address && !refresh_weather && 
-            !refresh_hour && !refresh_minute && !refresh_second && 
-            !refresh_date && !refresh_week) {
-            return;
-        }
-        
-        // 记录刷新类型
-        ESP_LOGI(TAG, "Refresh: Full=%d, Addr=%d, Weather=%d, Hour=%d, Min=%d, Sec=%d, Date=%d, Week=%d",
-                need_full_refresh, refresh_address, refresh_weather, 
-                refresh_hour, refresh_minute, refresh_second, 
-                refresh_date, refresh_week);
-
-        // 最后只刷新变化的部分
-        if (refresh_address) {
-            ESP_LOGI(TAG, "Refreshing address area");
-            if (address_area) lcd_restore_text_area_bg(lcd, address_area);
-            draw_address(lcd, address, 5, 5);
-        }
-        
-        if (refresh_weather) {
-            ESP_LOGI(TAG, "Refreshing weather area");
-            if (weather_area) lcd_restore_text_area_bg(lcd, weather_area);
-            draw_weather_info(lcd, weather, temperature, 64, 5);
-        }
-        
-        if (refresh_hour || refresh_minute) {
-            ESP_LOGI(TAG, "Refreshing time area (hour=%d, minute=%d)", refresh_hour, refresh_minute);
-            if (hour_area) lcd_restore_text_area_bg(lcd, hour_area);
-            if (minute_area) lcd_restore_text_area_bg(lcd, minute_area);
-            draw_time_without_seconds(lcd, hour, minute, 16, 80);
-        }
-        
-        if (refresh_second) {
-            ESP_LOGI(TAG, "Refreshing second area");
-            if (second_area) lcd_restore_text_area_bg(lcd, second_area);
-            draw_seconds(lcd, second, 16 + 68, 80 + 24);
-        }
-        
-        if (refresh_date || refresh_week) {
-            ESP_LOGI(TAG, "Refreshing date/week area (date=%d, week=%d)", refresh_date, refresh_week);
-            if (date_area) lcd_restore_text_area_bg(lcd, date_area);
-            draw_date_and_week(lcd, month, day, week, 16, 80 + 26);
-        }
     }
+    
+    // 秒/分/时先画，天气、地址等超出预算时顺延到补画帧
+    int deferred = widget_update(lcd, FRAME_BUDGET_US);
+    if (deferred > 0) {
+        ESP_LOGD(TAG, "%d widgets deferred to next frame", deferred);
+    }
+    return deferred;
 }
 
 // 辅助函数：绘制地址
@@ -666,10 +809,24 @@ void draw_address(lcd_display_t *lcd, const char* address, int x, int y)
 }
 
 // 辅助函数：绘制天气信息
-void draw_weather_info(lcd_display_t *lcd, const char* weather, const char* temperature, int x, int y)
+void draw_weather_info(lcd_display_t *lcd, const char* weather, const char* temperature, int weather_code, bool stale, int x, int y)
 {
     if (lcd == NULL || weather == NULL || temperature == NULL) return;
     
+    // 过期的缓存数据用灰色显示
+    uint16_t text_color = stale ? COLOR_GRAY : COLOR_WHITE;
+    uint16_t temp_color = stale ? COLOR_GRAY : COLOR_CYAN;
+    
+    // 有天气代码时直接画图集中的图标（一次窗口写入），温度显示在图标右侧
+    if (weather_code >= 0) {
+        weather_icon_draw(lcd, weather_icon_from_code(weather_code), x + 4, y + 4);
+        
+        lcd_set_font_size(lcd, FONT_SIZE_SMALL);
+        lcd_set_text_color(lcd, temp_color);
+        lcd_draw_string(lcd, x + 32, y + 8, strlen(temperature) > 0 ? temperature : "N/A");
+        return;
+    }
+    
     char display_weather[32];
     char display_temperature[8];
     
@@ -686,13 +843,13 @@ void draw_weather_info(lcd_display_t *lcd, const char* weather, const char* temp
     
     // 使用自定义字体显示天气汉字
     lcd_set_custom_font(lcd, show_custom_font);
-    lcd_set_text_color(lcd, COLOR_WHITE);
+    lcd_set_text_color(lcd, text_color);
     
     if (weatherCharCount <= 2) {
         lcd_draw_custom_string(lcd, x + 16, y, display_weather);
         
         lcd_set_font_size(lcd, FONT_SIZE_XSMALL);
-        lcd_set_text_color(lcd, COLOR_CYAN);
+        lcd_set_text_color(lcd, temp_color);
         char temp_str[16];
         snprintf(temp_str, sizeof(temp_str), "%s", display_temperature);
         lcd_draw_string(lcd, x + weatherCharCount * 16 + 16, y + 2, temp_str);
@@ -701,23 +858,18 @@ void draw_weather_info(lcd_display_t *lcd, const char* weather, const char* temp
         lcd_draw_custom_string(lcd, x, y, display_weather);
         
         lcd_set_font_size(lcd, FONT_SIZE_XSMALL);
-        lcd_set_text_color(lcd, COLOR_CYAN);
+        lcd_set_text_color(lcd, temp_color);
         char temp_str[16];
         snprintf(temp_str, sizeof(temp_str), "%s", display_temperature);
         int tempY = y + 16;
         lcd_draw_string(lcd, x + 16, tempY + 6, temp_str);
     }
     else {
-        char shortWeather[16] = {0};
-        strncpy(shortWeather, display_weather, 12);
-        if (strlen(display_weather) > 12) {
-            strcat(shortWeather, "...");
-        }
-        
-        lcd_draw_custom_string(lcd, x, y, shortWeather);
+        // 超过4个汉字放不下，交给滚动字幕循环显示
+        lcd_ticker_set_text(display_weather, text_color);
         
         lcd_set_font_size(lcd, FONT_SIZE_XSMALL);
-        lcd_set_text_color(lcd, COLOR_CYAN);
+        lcd_set_text_color(lcd, temp_color);
         char temp_str[16];
         snprintf(temp_str, sizeof(temp_str), "%s", display_temperature);
         int tempY = y + 16;
@@ -997,6 +1149,111 @@ void test_font_display(lcd_display_t *lcd)
 //     }
 // }
 
+// 渲染任务（固定在渲染核心）：按整秒事件刷新屏幕，天气数据通过无锁队列从网络核心获取
+static void render_task(void *arg)
+{
+    time_t lastTimeDisplay = 0;
+    
+    // 整秒调度：定时器在每个整秒边界通知渲染任务，不再每100ms轮询
+    clock_sched_start(xTaskGetCurrentTaskHandle());
+    
+    int deferred = 0;
+    while (1) {
+        // 正常情况下每秒被唤醒一次，超时只是兜底，防止调度器异常时界面停住；
+        // 上一帧有顺延的控件时短暂等待后补画
+        uint32_t events = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &events,
+                        deferred > 0 ? pdMS_TO_TICKS(FRAME_FOLLOWUP_MS) : pdMS_TO_TICKS(2000));
+        
+        // 绘制期间保持最高频率，画完释放，空闲时系统自动进入light sleep直到下一个整秒
+        power_mgmt_acquire(POWER_LOCK_RENDER);
+        
+        // 记录循环间隔，超过阈值时记为卡顿并归因到当时忙碌的子系统
+        loop_monitor_iteration();
+        
+        // 获取当前时间
+        time_t now;
+        time(&now);
+        
+        // 每30秒显示一次当前时间到日志
+        if (now - lastTimeDisplay >= TIME_DISPLAY_INTERVAL) {
+            display_current_time();
+            lastTimeDisplay = now;
+        }
+        
+        // 检查时间是否合理（不在1970年）
+        if (now < 1609459200) { // 2021-01-01 00:00:00之前的时间视为无效
+            ESP_LOGW(TAG, "System time is invalid, using default time");
+            struct timeval tv = {
+                .tv_sec = 1704067200, // 2024-01-01 00:00:00
+                .tv_usec = 0
+            };
+            settimeofday(&tv, NULL);
+            clock_sched_resync();
+            time(&now);
+        }
+        
+        // 增量推进本地时间（校时后由clock_sched_resync触发完整转换）
+        time_state_advance(&clock_time, now);
+        
+        // 读取天气任务发布的最新快照（不阻塞，网络慢或请求卡住时时钟照常刷新）
+        weather_snapshot_t snapshot;
+        if (weather_service_get(&snapshot, &weather_version)) {
+            TRACE(TRACE_EV_WEATHER, 0, weather_version, (uint32_t)snapshot.code);
+            ESP_LOGI(TAG, "Weather snapshot v%lu: %s, %s", weather_version, snapshot.weather, snapshot.temperature);
+            strcpy(now_weather, snapshot.weather);
+            strcpy(now_temperature, snapshot.temperature);
+            now_weather_code = snapshot.code;
+            now_weather_stale = snapshot.stale;
+            now_forecast = snapshot.forecast;
+            weather_pending_draw = true;
+        }
+        
+        // 显示信息（现在使用局部刷新功能）
+        loop_monitor_busy(LOOP_SUBSYS_SPI, true);
+        int64_t render_start = esp_timer_get_time();
+        deferred = show_info_on_image(&g_lcd, &clock_time,
+                          now_address, now_weather, now_temperature, now_weather_code, now_weather_stale,
+                          &now_forecast);
+        loop_monitor_render((uint32_t)(esp_timer_get_time() - render_start));
+        loop_monitor_busy(LOOP_SUBSYS_SPI, false);
+        clock_sched_mark_drawn(weather_service_busy());
+        // 所有控件都画完（没有推迟到下一帧）才算新天气上屏
+        if (weather_pending_draw && deferred == 0) {
+            weather_service_mark_rendered(weather_version);
+            weather_pending_draw = false;
+        }
+        
+        // 每分钟输出一次调度精度和tick-to-pixel延迟
+        if (events & CLOCK_EVT_MINUTE) {
+            clock_sched_stats_t stats;
+            clock_sched_get_stats(&stats);
+            ESP_LOGI(TAG, "Scheduler: %lu ticks, fire offset avg %ld us (max %ld), tick-to-pixel avg %lu us (max %lu)",
+                     stats.ticks, stats.avg_fire_offset_us, stats.max_fire_offset_us,
+                     stats.avg_latency_us, stats.max_latency_us);
+            ESP_LOGI(TAG, "Render jitter: net idle %lu us (%lu samples), net busy %lu us (%lu samples)",
+                     stats.jitter_us[0], stats.samples[0], stats.jitter_us[1], stats.samples[1]);
+            
+            widget_frame_stats_t frame;
+            widget_get_frame_stats(&frame);
+            ESP_LOGI(TAG, "Frames: %lu, avg %lu us (max %lu), %lu over budget, %lu widgets deferred",
+                     frame.frames, frame.avg_frame_us, frame.max_frame_us, frame.over_budget, frame.deferred);
+            
+            widget_queue_stats_t queue;
+            widget_get_queue_stats(&queue);
+            ESP_LOGI(TAG, "Render queue: %lu submitted, %lu coalesced, %lu executed",
+                     queue.submitted, queue.coalesced, queue.executed);
+            
+            time_state_stats_t ts_stats;
+            time_state_get_stats(&clock_time, &ts_stats);
+            ESP_LOGI(TAG, "Time state: %lu incremental steps, %lu full conversions",
+                     ts_stats.steps, ts_stats.resyncs);
+        }
+        
+        power_mgmt_release(POWER_LOCK_RENDER);
+    }
+}
+
 void app_main(void)
 {
     ESP_LOGI(TAG, "Starting TFT Clock Application with Partial Refresh");
@@ -1011,6 +1268,9 @@ void app_main(void)
     }
     ESP_ERROR_CHECK(ret);
 
+    // 动态调频和自动light sleep：每秒只在整秒调度定时器唤醒后画一帧
+    power_mgmt_init();
+
     // 初始化LCD
     lcd_config_t lcd_config = {
         .miso_io_num = 11,
@@ -1023,6 +1283,7 @@ void app_main(void)
         .width = 128,
         .height = 128,
         .invert_colors = true,
+        .color_mode = LCD_COLOR_MODE_16BIT, // 改为12位可减少25%总线字节，颜色精度降为RGB444
     };
     
     // 使用全局变量g_lcd
@@ -1031,6 +1292,13 @@ void app_main(void)
         return;
     }
     
+#if CONFIG_LCD_FRAME_CAPTURE
+    // 开启截图（占用32KB影子帧缓冲，可在串口用screenshot命令导出画面）
+    lcd_capture_enable(&g_lcd);
+#endif
+    // 串口控制台（诊断命令）；没有开启截图时screenshot/framecrc会提示未启用
+    console_cmds_start(&g_lcd);
+
     // 设置全局LCD对象供字体函数使用
     set_global_lcd(&g_lcd);
     
@@ -1043,6 +1311,7 @@ void app_main(void)
     // 初始化文字区域（局部刷新功能）
     ESP_LOGI(TAG, "Initializing text areas for partial refresh...");
     init_text_areas(&g_lcd);
+    init_widgets();
     
     // 测试字体显示
     test_font_display(&g_lcd);
@@ -1089,6 +1358,9 @@ void app_main(void)
     
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
     ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config));
+    
+    // 天气网络任务要在联网事件之前启动，联网后由事件处理函数触发第一次请求
+    weather_service_start();
     ESP_ERROR_CHECK(esp_wifi_start());
 
     ESP_LOGI(TAG, "Connecting to WiFi...");
@@ -1117,106 +1389,47 @@ void app_main(void)
         if (weather_area) lcd_save_text_area_bg(&g_lcd, weather_area);
         if (address_area) lcd_save_text_area_bg(&g_lcd, address_area);
         if (second_area) lcd_save_text_area_bg(&g_lcd, second_area);
+        if (forecast_area) lcd_save_text_area_bg(&g_lcd, forecast_area);
+        
+        // 启动天气动画图标（与天气区域的图标槽位重合）
+        weather_anim_init(&g_lcd, 64 + 4, 5 + 4);
+        
+        // 启动天气滚动字幕（天气区域第一行）
+        lcd_ticker_init(&g_lcd, 64, 5, 64);
         
         // 获取初始时间并显示
         time_t now;
-        struct tm timeinfo;
         time(&now);
-        localtime_r(&now, &timeinfo);
+        time_state_sync(&clock_time, now);
         
-        // 获取初始天气信息
-        if (get_weather_info(now_weather, now_temperature, sizeof(now_weather))) {
-            ESP_LOGI(TAG, "Initial weather info: %s, %s", now_weather, now_temperature);
+        // 初始天气信息：天气任务已经拿到数据就直接用，否则先显示未知，拿到后再刷新
+        weather_snapshot_t snapshot;
+        if (weather_service_get(&snapshot, &weather_version)) {
+            strcpy(now_weather, snapshot.weather);
+            strcpy(now_temperature, snapshot.temperature);
+            now_weather_code = snapshot.code;
+            now_weather_stale = snapshot.stale;
+            now_forecast = snapshot.forecast;
+            ESP_LOGI(TAG, "Initial weather info: %s, %s%s", now_weather, now_temperature,
+                     snapshot.stale ? " (stale cache)" : "");
         } else {
             strcpy(now_weather, "未知");
             strcpy(now_temperature, "N/A");
+            now_weather_code = -1;
         }
         
         // 显示初始信息
-        show_info_on_image(&g_lcd, 
-                          timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec,
-                          timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-                          weekDays[timeinfo.tm_wday],
-                          now_address, now_weather, now_temperature);
+        show_info_on_image(&g_lcd, &clock_time,
+                          now_address, now_weather, now_temperature, now_weather_code, now_weather_stale,
+                          &now_forecast);
         
         firstRun = false;
     }
     // ============ 这里结束添加您的代码 ============
     
-    // 主循环
-    time_t last_time_check = time(NULL);
-    const time_t max_stuck_time = 60; // 60秒最大卡住时间
-    bool time_initialized = false;
-    time_t lastTimeDisplay = 0;
-    
-    // 首次运行标志已经在上面处理过了，这里设置为false
-    // firstRun = false; // 这行不需要，因为上面已经设置了
-    
-    while (1) {
-        // 获取当前时间
-        time_t now;
-        struct tm timeinfo;
-        time(&now);
-        
-        // 每30秒显示一次当前时间到日志
-        if (now - lastTimeDisplay >= TIME_DISPLAY_INTERVAL) {
-            display_current_time();
-            lastTimeDisplay = now;
-        }
-        
-        // 检查是否卡在时间同步
-        if (!time_initialized && now - last_time_check > max_stuck_time) {
-            ESP_LOGW(TAG, "System seems stuck, forcing time recovery");
-            struct timeval tv = {
-                .tv_sec = now + 1, // 至少让时间前进
-                .tv_usec = 0
-            };
-            settimeofday(&tv, NULL);
-            last_time_check = now;
-            time_initialized = true;
-        }
-        
-        // 检查时间是否合理（不在1970年）
-        if (now < 1609459200) { // 2021-01-01 00:00:00之前的时间视为无效
-            ESP_LOGW(TAG, "System time is invalid, using default time");
-            struct timeval tv = {
-                .tv_sec = 1704067200, // 2024-01-01 00:00:00
-                .tv_usec = 0
-            };
-            settimeofday(&tv, NULL);
-            time(&now);
-        }
-        
-        localtime_r(&now, &timeinfo);
-        
-        // 定期更新天气信息（每10分钟，避免API限制）
-        if (now - lastWeatherUpdate >= WEATHER_UPDATE_INTERVAL) {
-            ESP_LOGI(TAG, "Attempting to update weather information...");
-            
-            // 保存当前天气信息作为备份
-            char backup_weather[32];
-            char backup_temperature[8];
-            strcpy(backup_weather, now_weather);
-            strcpy(backup_temperature, now_temperature);
-            
-            if (get_weather_info(now_weather, now_temperature, sizeof(now_weather))) {
-                ESP_LOGI(TAG, "Weather info updated: %s, %s", now_weather, now_temperature);
-                lastWeatherUpdate = now;
-            } else {
-                ESP_LOGW(TAG, "Failed to update weather info, using previous data");
-                // 恢复备份数据
-                strcpy(now_weather, backup_weather);
-                strcpy(now_temperature, backup_temperature);
-            }
-        }
-        
-        // 显示信息（现在使用局部刷新功能）
-        show_info_on_image(&g_lcd, 
-                          timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec,
-                          timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-                          weekDays[timeinfo.tm_wday],
-                          now_address, now_weather, now_temperature);
-        
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+    // 主循环放到渲染核心上运行，app_main到此结束
+    if (xTaskCreatePinnedToCore(render_task, "render", 4096, NULL, tskIDLE_PRIORITY + 1,
+                                NULL, APP_CORE_RENDER) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create render task");
     }
-}
\ No newline at end of file
+}
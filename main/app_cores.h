@@ -0,0 +1,8 @@
+#ifndef APP_CORES_H
+#define APP_CORES_H
+
+// 核心分工：网络（WiFi/lwIP/SNTP/天气请求）固定在核心0，渲染（时钟、动画、字幕）固定在核心1
+#define APP_CORE_NET    0
+#define APP_CORE_RENDER 1
+
+#endif
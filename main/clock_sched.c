@@ -0,0 +1,160 @@
+#include "clock_sched.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "trace.h"
+#include "time_state.h"
+#include <math.h>
+#include <sys/time.h>
+#include <time.h>
+
+static const char *TAG = "CLOCK_SCHED";
+
+// 在整秒边界之后稍微延后触发，保证回调里读到的已经是新的一秒
+#define CLOCK_SCHED_GUARD_US 500
+
+static esp_timer_handle_t s_timer = NULL;
+static TaskHandle_t s_task = NULL;
+
+// 上一次事件对应的时间，增量推进后根据变化字段判断是否跨分/时/天（校时后完整转换，全部字段视为变化）
+static time_state_t s_time;
+
+// 最近一次整秒事件的触发时刻（esp_timer时间），0表示已经统计过
+static volatile int64_t s_tick_us = 0;
+
+// 统计（累计值在分钟事件时汇总）
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static clock_sched_stats_t s_stats = {0};
+static int64_t s_sum_offset_us = 0;
+static uint32_t s_offset_count = 0;
+static uint64_t s_sum_latency_us = 0;
+static uint32_t s_latency_count = 0;
+static uint64_t s_bucket_sum[2] = {0};
+static uint64_t s_bucket_sum_sq[2] = {0};
+
+// 按当前系统时间计算到下一个整秒边界的延时并启动单次定时器
+static void arm_next_second(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+
+    uint64_t delay_us = 1000000 - tv.tv_usec + CLOCK_SCHED_GUARD_US;
+    esp_timer_stop(s_timer);
+    esp_timer_start_once(s_timer, delay_us);
+}
+
+static void clock_timer_callback(void *arg)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    int64_t fired_us = esp_timer_get_time();
+
+    // 先重新对齐下一秒：每秒都按墙上时间重新计算，SNTP平滑校时引起的漂移不会累积
+    arm_next_second();
+
+    uint32_t changed = time_state_advance(&s_time, tv.tv_sec);
+
+    uint32_t events = CLOCK_EVT_SECOND;
+    if (changed & TIME_FIELD_MINUTE) events |= CLOCK_EVT_MINUTE;
+    if (changed & TIME_FIELD_HOUR) events |= CLOCK_EVT_HOUR;
+    if (changed & TIME_FIELD_DAY) events |= CLOCK_EVT_DAY;
+
+    // 触发偏差：tv_usec越接近保护时间越准（跨过半秒视为提前触发）
+    int32_t offset = (int32_t)tv.tv_usec - CLOCK_SCHED_GUARD_US;
+    if (tv.tv_usec > 500000) offset = (int32_t)tv.tv_usec - 1000000 - CLOCK_SCHED_GUARD_US;
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.ticks++;
+    s_sum_offset_us += offset;
+    s_offset_count++;
+    int32_t abs_offset = offset < 0 ? -offset : offset;
+    if (abs_offset > s_stats.max_fire_offset_us) s_stats.max_fire_offset_us = abs_offset;
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    s_tick_us = fired_us;
+    xTaskNotify(s_task, events, eSetBits);
+}
+
+esp_err_t clock_sched_start(TaskHandle_t task)
+{
+    if (task == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_timer != NULL) {
+        return ESP_OK;
+    }
+
+    s_task = task;
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = clock_timer_callback,
+        .name = "clock_sched",
+    };
+    esp_err_t ret = esp_timer_create(&timer_args, &s_timer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create scheduler timer: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    arm_next_second();
+    ESP_LOGI(TAG, "Second-aligned scheduler started");
+    return ESP_OK;
+}
+
+void clock_sched_resync(void)
+{
+    // 时间可能跳变，所有time_state下一次推进时完整转换，事件带上分/时/天，所有区域按新时间刷新
+    time_state_mark_adjusted();
+
+    if (s_timer == NULL) {
+        return;
+    }
+    arm_next_second();
+    ESP_LOGI(TAG, "Realigned to wall-clock second boundary");
+}
+
+void clock_sched_mark_drawn(bool net_busy)
+{
+    int64_t tick = s_tick_us;
+    if (tick == 0) {
+        return;
+    }
+    s_tick_us = 0;
+
+    uint32_t latency = (uint32_t)(esp_timer_get_time() - tick);
+    TRACE(TRACE_EV_TICK_DRAWN, net_busy ? 1 : 0, latency, 0);
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_sum_latency_us += latency;
+    s_latency_count++;
+    if (latency > s_stats.max_latency_us) s_stats.max_latency_us = latency;
+    int bucket = net_busy ? 1 : 0;
+    s_stats.samples[bucket]++;
+    s_bucket_sum[bucket] += latency;
+    s_bucket_sum_sq[bucket] += (uint64_t)latency * latency;
+    portEXIT_CRITICAL(&s_stats_lock);
+}
+
+void clock_sched_get_stats(clock_sched_stats_t *stats)
+{
+    if (stats == NULL) return;
+
+    portENTER_CRITICAL(&s_stats_lock);
+    *stats = s_stats;
+    stats->avg_fire_offset_us = s_offset_count ? (int32_t)(s_sum_offset_us / s_offset_count) : 0;
+    stats->avg_latency_us = s_latency_count ? (uint32_t)(s_sum_latency_us / s_latency_count) : 0;
+    uint64_t sum[2] = { s_bucket_sum[0], s_bucket_sum[1] };
+    uint64_t sum_sq[2] = { s_bucket_sum_sq[0], s_bucket_sum_sq[1] };
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    // 标准差放在临界区外计算
+    for (int i = 0; i < 2; i++) {
+        uint32_t n = stats->samples[i];
+        if (n == 0) {
+            stats->jitter_us[i] = 0;
+            continue;
+        }
+        double mean = (double)sum[i] / n;
+        double var = (double)sum_sq[i] / n - mean * mean;
+        stats->jitter_us[i] = var > 0 ? (uint32_t)sqrt(var) : 0;
+    }
+}
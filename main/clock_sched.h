@@ -0,0 +1,41 @@
+#ifndef CLOCK_SCHED_H
+#define CLOCK_SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// 任务通知位：每次整秒都有SECOND，跨分/时/天时同时带上对应位
+#define CLOCK_EVT_SECOND (1 << 0)
+#define CLOCK_EVT_MINUTE (1 << 1)
+#define CLOCK_EVT_HOUR   (1 << 2)
+#define CLOCK_EVT_DAY    (1 << 3)
+#define CLOCK_EVT_ALL    (CLOCK_EVT_SECOND | CLOCK_EVT_MINUTE | CLOCK_EVT_HOUR | CLOCK_EVT_DAY)
+
+// 调度统计
+typedef struct {
+    uint32_t ticks;              // 累计整秒事件数
+    int32_t avg_fire_offset_us;  // 定时器触发时刻相对整秒边界的平均偏差
+    int32_t max_fire_offset_us;  // 最大偏差
+    uint32_t avg_latency_us;     // 整秒事件到像素发送完成的平均延迟
+    uint32_t max_latency_us;     // 最大延迟
+    uint32_t samples[2];         // 延迟样本数：[0]网络空闲，[1]网络繁忙
+    uint32_t jitter_us[2];       // 延迟标准差（渲染抖动）：[0]网络空闲，[1]网络繁忙
+} clock_sched_stats_t;
+
+// 启动整秒调度器，事件以任务通知的方式发给task
+esp_err_t clock_sched_start(TaskHandle_t task);
+
+// 系统时间被直接设置后（SNTP同步、手动校时）调用，立即重新对齐到整秒边界
+void clock_sched_resync(void);
+
+// 整秒事件对应的像素发送完成后调用，用于统计tick-to-pixel延迟；
+// net_busy表示这一秒内网络核心正在请求，分开统计以对比网络负载对渲染抖动的影响
+void clock_sched_mark_drawn(bool net_busy);
+
+// 获取调度统计
+void clock_sched_get_stats(clock_sched_stats_t *stats);
+
+#endif
@@ -0,0 +1,368 @@
+#include "console_cmds.h"
+#include "lcd_capture.h"
+#include "trace.h"
+#include "power_mgmt.h"
+#include "clock_sched.h"
+#include "loop_monitor.h"
+#include "weather.h"
+#include "dns_cache.h"
+#include "weather_service.h"
+#include "weather_anim.h"
+#include "lcd_ticker.h"
+#include "widget.h"
+#include "esp_console.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+
+static const char *TAG = "CONSOLE";
+
+// 命令使用的LCD对象
+static lcd_display_t *s_lcd = NULL;
+
+// 最后一次串口输入后保持唤醒的时间
+#define CONSOLE_AWAKE_S 30
+
+// screenshot [path]：不带参数时以base64输出到串口，带参数时保存为PPM文件
+static int cmd_screenshot(int argc, char **argv)
+{
+    esp_err_t ret;
+    if (argc > 1) {
+        ret = lcd_capture_save_file(s_lcd, argv[1]);
+    } else {
+        ret = lcd_capture_dump_console(s_lcd);
+    }
+
+    if (ret != ESP_OK) {
+        printf("screenshot failed: %s\n", esp_err_to_name(ret));
+        return 1;
+    }
+    return 0;
+}
+
+// framecrc：输出当前帧CRC32，长时间运行测试中用于比对画面
+static int cmd_framecrc(int argc, char **argv)
+{
+    if (s_lcd == NULL || s_lcd->shadow == NULL) {
+        printf("frame capture is not enabled\n");
+        return 1;
+    }
+    printf("frame crc32: %08lx\n", lcd_capture_crc32(s_lcd));
+    return 0;
+}
+
+// lcdbench [n]：对比16位/12位传输模式的刷新耗时（会重绘背景图，结束后整屏重画所有控件）
+static int cmd_lcdbench(int argc, char **argv)
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : 5;
+    if (iterations <= 0) {
+        printf("invalid iteration count\n");
+        return 1;
+    }
+
+    // 测试期间动画和字幕不写总线，免得计入测得的耗时
+    weather_anim_pause(true);
+    lcd_ticker_pause(true);
+    lcd_benchmark_color_modes(s_lcd, iterations);
+    lcd_ticker_pause(false);
+    weather_anim_pause(false);
+
+    // 测试最后重画了背景图，时钟、日期、地址、天气和预报都要重画
+    widget_invalidate_all();
+    return 0;
+}
+
+// colormode 12|16：切换像素传输格式
+static int cmd_colormode(int argc, char **argv)
+{
+    if (argc > 1) {
+        int bits = atoi(argv[1]);
+        if (bits != 12 && bits != 16) {
+            printf("usage: colormode 12|16\n");
+            return 1;
+        }
+        lcd_set_color_mode(s_lcd, bits == 12 ? LCD_COLOR_MODE_12BIT : LCD_COLOR_MODE_16BIT);
+    }
+    printf("color mode: %d-bit\n", s_lcd->color_mode == LCD_COLOR_MODE_12BIT ? 12 : 16);
+    return 0;
+}
+
+// trace [n]：解码输出最近n条跟踪记录（默认32条）
+static int cmd_trace(int argc, char **argv)
+{
+    int count = argc > 1 ? atoi(argv[1]) : 32;
+    trace_dump(count);
+    return 0;
+}
+
+// power：各电源状态时间、频率锁占用，以及唤醒到像素发送完成的延迟
+static int cmd_power(int argc, char **argv)
+{
+    power_mgmt_dump(stdout);
+
+    clock_sched_stats_t stats;
+    clock_sched_get_stats(&stats);
+    printf("wake-to-pixel: avg %lu us, max %lu us over %lu ticks\n",
+           stats.avg_latency_us, stats.max_latency_us, stats.ticks);
+    return 0;
+}
+
+// loopstat：主循环周期/渲染耗时直方图和最长的几次卡顿
+static int cmd_loopstat(int argc, char **argv)
+{
+    loop_monitor_dump(stdout);
+    return 0;
+}
+
+// weatherstat：天气HTTP客户端的连接复用情况和耗时
+static int cmd_weatherstat(int argc, char **argv)
+{
+    weather_client_stats_t stats;
+    weather_get_client_stats(&stats);
+    printf("provider %s\n", weather_get_provider()->name);
+    printf("requests %lu (new connection %lu, reused %lu), failed attempts %lu\n",
+           stats.requests, stats.connects, stats.reused, stats.failures);
+    printf("connect avg %lu us (max %lu, last %lu), request avg %lu us (max %lu)\n",
+           stats.avg_connect_us, stats.max_connect_us, stats.last_connect_us,
+           stats.avg_request_us, stats.max_request_us);
+    printf("updates: full %lu, not modified (304) %lu, unchanged last_update %lu, oversized %lu\n",
+           stats.full_updates, stats.not_modified, stats.unchanged, stats.overflows);
+
+    weather_heap_stats_t heap;
+    weather_service_get_heap_stats(&heap);
+    printf("heap over %lu refreshes: last delta %ld, drift %ld, min largest free block %lu\n",
+           heap.cycles, heap.last_delta, heap.drift, heap.min_largest_block);
+    printf("weather task stack: min free %lu bytes\n", heap.stack_free_min);
+
+    retry_policy_t retry;
+    weather_service_get_retry(&retry);
+    printf("circuit %s, consecutive failures %lu (total %lu), opened %lu times, probes %lu",
+           retry_policy_state_name(retry.state), retry.consecutive_failures, retry.total_failures,
+           retry.opens, retry.probes);
+    if (retry.consecutive_failures > 0) {
+        printf(", next attempt after %lu s", retry.next_delay_ms / 1000);
+    }
+    printf("\n");
+    return 0;
+}
+
+// weatherbench [provider] [runs]：用指定数据源（默认mock）连续刷新，测量取数到上屏的延迟和吞吐
+static int cmd_weatherbench(int argc, char **argv)
+{
+    const char *name = argc > 1 ? argv[1] : "mock";
+    int runs = argc > 2 ? atoi(argv[2]) : 10;
+    const weather_provider_t *provider = weather_provider_find(name);
+    if (provider == NULL || runs <= 0) {
+        printf("usage: weatherbench [seniverse|mock] [runs]\n");
+        return 1;
+    }
+
+    esp_err_t ret = weather_service_bench(provider, runs, stdout);
+    if (ret != ESP_OK) {
+        printf("weatherbench failed: %s\n", esp_err_to_name(ret));
+        return 1;
+    }
+    return 0;
+}
+
+// weathermock [latency_ms chunk_bytes chunk_delay_ms fail_every [http|truncate|timeout]]：
+// 查看或设置模拟数据源的脚本
+static int cmd_weathermock(int argc, char **argv)
+{
+    weather_mock_script_t script;
+    weather_mock_get_script(&script);
+
+    if (argc > 1) {
+        if (argc < 5) {
+            printf("usage: weathermock [latency_ms chunk_bytes chunk_delay_ms fail_every [http|truncate|timeout]]\n");
+            return 1;
+        }
+        script.latency_ms = (uint32_t)atoi(argv[1]);
+        script.chunk_bytes = (uint32_t)atoi(argv[2]);
+        script.chunk_delay_ms = (uint32_t)atoi(argv[3]);
+        script.fail_every = (uint32_t)atoi(argv[4]);
+        if (argc > 5) {
+            if (strcmp(argv[5], "http") == 0) {
+                script.error = WEATHER_MOCK_ERROR_HTTP;
+            } else if (strcmp(argv[5], "truncate") == 0) {
+                script.error = WEATHER_MOCK_ERROR_TRUNCATE;
+            } else if (strcmp(argv[5], "timeout") == 0) {
+                script.error = WEATHER_MOCK_ERROR_TIMEOUT;
+            } else {
+                printf("unknown error type: %s\n", argv[5]);
+                return 1;
+            }
+        }
+        weather_mock_set_script(&script);
+    }
+
+    printf("mock: latency %lu ms, %lu-byte chunks every %lu ms, ", script.latency_ms, script.chunk_bytes,
+           script.chunk_delay_ms);
+    if (script.fail_every > 0) {
+        printf("%s failure every %lu requests\n", weather_mock_error_name(script.error), script.fail_every);
+    } else {
+        printf("no failures\n");
+    }
+    return 0;
+}
+
+// dnsstat：DNS缓存条目、命中率和解析耗时
+static int cmd_dnsstat(int argc, char **argv)
+{
+    dns_cache_dump(stdout);
+    return 0;
+}
+
+static void register_commands(void)
+{
+    const esp_console_cmd_t screenshot_cmd = {
+        .command = "screenshot",
+        .help = "Dump the current frame as PPM (base64 to console, or to a file path)",
+        .hint = "[path]",
+        .func = &cmd_screenshot,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&screenshot_cmd));
+
+    const esp_console_cmd_t framecrc_cmd = {
+        .command = "framecrc",
+        .help = "Print CRC32 of the current frame",
+        .hint = NULL,
+        .func = &cmd_framecrc,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&framecrc_cmd));
+
+    const esp_console_cmd_t lcdbench_cmd = {
+        .command = "lcdbench",
+        .help = "Benchmark full-screen and region updates in 16-bit and 12-bit color modes",
+        .hint = "[iterations]",
+        .func = &cmd_lcdbench,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&lcdbench_cmd));
+
+    const esp_console_cmd_t colormode_cmd = {
+        .command = "colormode",
+        .help = "Show or set the pixel transfer format",
+        .hint = "[12|16]",
+        .func = &cmd_colormode,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&colormode_cmd));
+
+    const esp_console_cmd_t trace_cmd = {
+        .command = "trace",
+        .help = "Decode and print the most recent hot-path trace records",
+        .hint = "[count]",
+        .func = &cmd_trace,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&trace_cmd));
+
+    const esp_console_cmd_t power_cmd = {
+        .command = "power",
+        .help = "Print time spent in each power state and wake-to-pixel latency",
+        .hint = NULL,
+        .func = &cmd_power,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&power_cmd));
+
+    const esp_console_cmd_t loopstat_cmd = {
+        .command = "loopstat",
+        .help = "Print main-loop and render latency histograms and the longest stalls",
+        .hint = NULL,
+        .func = &cmd_loopstat,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&loopstat_cmd));
+
+    const esp_console_cmd_t weatherstat_cmd = {
+        .command = "weatherstat",
+        .help = "Print weather HTTP client connection reuse, timing, skipped updates and retry state",
+        .hint = NULL,
+        .func = &cmd_weatherstat,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&weatherstat_cmd));
+
+    const esp_console_cmd_t dnsstat_cmd = {
+        .command = "dnsstat",
+        .help = "Print DNS cache entries, hit/miss counters and lookup latency",
+        .hint = NULL,
+        .func = &cmd_dnsstat,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&dnsstat_cmd));
+
+    const esp_console_cmd_t weatherbench_cmd = {
+        .command = "weatherbench",
+        .help = "Measure fetch-to-render latency and refresh throughput for a weather provider",
+        .hint = "[seniverse|mock] [runs]",
+        .func = &cmd_weatherbench,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&weatherbench_cmd));
+
+    const esp_console_cmd_t weathermock_cmd = {
+        .command = "weathermock",
+        .help = "Show or set the mock provider's injected latency, chunking and failures",
+        .hint = "[latency_ms chunk_bytes chunk_delay_ms fail_every [http|truncate|timeout]]",
+        .func = &cmd_weathermock,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&weathermock_cmd));
+}
+
+// 控制台唤醒任务：light sleep期间串口收不到字符，串口唤醒只能把芯片叫醒（前几个字符丢失）。
+// 收到输入后持有不进light sleep的锁，直到CONSOLE_AWAKE_S秒内没有新输入，保证整行命令能收全
+static void console_wake_task(void *arg)
+{
+    int fd = fileno(stdin);
+    bool awake = false;
+
+    while (1) {
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(fd, &fds);
+        struct timeval timeout = { .tv_sec = CONSOLE_AWAKE_S, .tv_usec = 0 };
+        int n = select(fd + 1, &fds, NULL, NULL, awake ? &timeout : NULL);
+
+        if (n > 0) {
+            if (!awake) {
+                power_mgmt_acquire(POWER_LOCK_CONSOLE);
+                awake = true;
+            }
+            // 数据由REPL任务读走，稍等再检查，避免对同一批数据反复返回
+            vTaskDelay(pdMS_TO_TICKS(50));
+        } else if (n == 0) {
+            power_mgmt_release(POWER_LOCK_CONSOLE);
+            awake = false;
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(1000));
+        }
+    }
+}
+
+esp_err_t console_cmds_start(lcd_display_t *lcd)
+{
+    s_lcd = lcd;
+
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = "clock>";
+    repl_config.max_cmdline_length = 128;
+
+    esp_console_dev_uart_config_t uart_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    esp_err_t ret = esp_console_new_repl_uart(&uart_config, &repl_config, &repl);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create console REPL: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    esp_console_register_help_command();
+    register_commands();
+
+    // REPL已安装串口驱动，此时才能配置串口唤醒
+    power_mgmt_enable_uart_wakeup(uart_config.channel);
+    if (xTaskCreate(console_wake_task, "console_wake", 2048, NULL, tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+        ESP_LOGW(TAG, "Failed to create console wake task");
+    }
+
+    return esp_console_start_repl(repl);
+}
@@ -0,0 +1,10 @@
+#ifndef CONSOLE_CMDS_H
+#define CONSOLE_CMDS_H
+
+#include "esp_err.h"
+#include "lcd_driver.h"
+
+// 启动串口控制台并注册调试命令（截图等）
+esp_err_t console_cmds_start(lcd_display_t *lcd);
+
+#endif
@@ -0,0 +1,221 @@
+#include "dns_cache.h"
+#include "app_cores.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lwip/netdb.h"
+#include <string.h>
+
+static const char *TAG = "DNS_CACHE";
+
+#define DNS_CACHE_HOST_LEN    48
+#define DNS_CACHE_MAX_PREFETCH 4
+
+typedef struct {
+    char host[DNS_CACHE_HOST_LEN];   // 空字符串表示空闲
+    struct in_addr addr;
+    int64_t expires_us;              // esp_timer时间，0表示已失效
+    int64_t last_used_us;            // 满了以后替换最久没用的
+} dns_cache_entry_t;
+
+// 查询可能来自天气任务、对时任务和预解析任务，条目读写都很短，用自旋锁保护
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static dns_cache_entry_t s_entries[DNS_CACHE_SIZE];
+static dns_cache_stats_t s_stats = {0};
+static uint32_t s_lookups = 0;
+static uint64_t s_total_lookup_us = 0;
+
+static const char *s_prefetch_hosts[DNS_CACHE_MAX_PREFETCH];
+static size_t s_prefetch_count = 0;
+static volatile bool s_prefetching = false;
+
+static dns_cache_entry_t *find_entry(const char *host)
+{
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        if (strcmp(s_entries[i].host, host) == 0) {
+            return &s_entries[i];
+        }
+    }
+    return NULL;
+}
+
+static dns_cache_entry_t *alloc_entry(const char *host)
+{
+    dns_cache_entry_t *victim = &s_entries[0];
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        if (s_entries[i].host[0] == '\0') {
+            victim = &s_entries[i];
+            break;
+        }
+        if (s_entries[i].last_used_us < victim->last_used_us) {
+            victim = &s_entries[i];
+        }
+    }
+    memset(victim, 0, sizeof(*victim));
+    snprintf(victim->host, sizeof(victim->host), "%s", host);
+    return victim;
+}
+
+// 实际解析一次，返回是否成功
+static bool resolve(const char *host, struct in_addr *addr)
+{
+    struct addrinfo hints = {0};
+    struct addrinfo *res = NULL;
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    int64_t start = esp_timer_get_time();
+    int err = getaddrinfo(host, NULL, &hints, &res);
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+
+    bool ok = err == 0 && res != NULL;
+    if (ok) {
+        *addr = ((struct sockaddr_in *)res->ai_addr)->sin_addr;
+    }
+    if (res != NULL) {
+        freeaddrinfo(res);
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    s_lookups++;
+    s_total_lookup_us += elapsed;
+    s_stats.avg_lookup_us = (uint32_t)(s_total_lookup_us / s_lookups);
+    if (elapsed > s_stats.max_lookup_us) s_stats.max_lookup_us = elapsed;
+    portEXIT_CRITICAL(&s_lock);
+
+    if (ok) {
+        char text[16];
+        inet_ntoa_r(*addr, text, sizeof(text));
+        ESP_LOGI(TAG, "Resolved %s -> %s in %lu us", host, text, elapsed);
+    } else {
+        ESP_LOGW(TAG, "Failed to resolve %s (err %d) after %lu us", host, err, elapsed);
+    }
+    return ok;
+}
+
+esp_err_t dns_cache_lookup(const char *host, struct in_addr *addr)
+{
+    if (host == NULL || addr == NULL || strlen(host) >= DNS_CACHE_HOST_LEN) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int64_t now = esp_timer_get_time();
+    bool have_old = false;
+    struct in_addr old_addr = {0};
+
+    portENTER_CRITICAL(&s_lock);
+    dns_cache_entry_t *entry = find_entry(host);
+    if (entry != NULL) {
+        entry->last_used_us = now;
+        if (now < entry->expires_us) {
+            *addr = entry->addr;
+            s_stats.hits++;
+            portEXIT_CRITICAL(&s_lock);
+            return ESP_OK;
+        }
+        have_old = entry->addr.s_addr != 0;
+        old_addr = entry->addr;
+    }
+    s_stats.misses++;
+    portEXIT_CRITICAL(&s_lock);
+
+    // 解析可能要几百毫秒，不能持有自旋锁
+    struct in_addr resolved;
+    bool ok = resolve(host, &resolved);
+
+    portENTER_CRITICAL(&s_lock);
+    if (ok) {
+        entry = find_entry(host);
+        if (entry == NULL) {
+            entry = alloc_entry(host);
+        }
+        entry->addr = resolved;
+        entry->expires_us = esp_timer_get_time() + (int64_t)DNS_CACHE_TTL_S * 1000000;
+        entry->last_used_us = now;
+        *addr = resolved;
+    } else if (have_old) {
+        // 解析失败时旧地址大概率还能用，比直接失败好
+        *addr = old_addr;
+        s_stats.stale_hits++;
+    } else {
+        s_stats.failures++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    return (ok || have_old) ? ESP_OK : ESP_FAIL;
+}
+
+void dns_cache_invalidate(const char *host)
+{
+    portENTER_CRITICAL(&s_lock);
+    dns_cache_entry_t *entry = find_entry(host);
+    if (entry != NULL) {
+        entry->expires_us = 0;
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+static void prefetch_task(void *arg)
+{
+    for (size_t i = 0; i < s_prefetch_count; i++) {
+        struct in_addr addr;
+        dns_cache_lookup(s_prefetch_hosts[i], &addr);
+    }
+    s_prefetching = false;
+    vTaskDelete(NULL);
+}
+
+void dns_cache_prefetch(const char *const *hosts, size_t count)
+{
+    // 短时间内多次联网时只保留一个预解析任务
+    if (s_prefetching) {
+        return;
+    }
+    s_prefetch_count = count < DNS_CACHE_MAX_PREFETCH ? count : DNS_CACHE_MAX_PREFETCH;
+    memcpy(s_prefetch_hosts, hosts, s_prefetch_count * sizeof(hosts[0]));
+    s_prefetching = true;
+
+    if (xTaskCreatePinnedToCore(prefetch_task, "dns_prefetch", 3072, NULL, 5, NULL, APP_CORE_NET) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create DNS prefetch task");
+        s_prefetching = false;
+    }
+}
+
+void dns_cache_get_stats(dns_cache_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void dns_cache_dump(FILE *stream)
+{
+    dns_cache_entry_t entries[DNS_CACHE_SIZE];
+    dns_cache_stats_t stats;
+    portENTER_CRITICAL(&s_lock);
+    memcpy(entries, s_entries, sizeof(entries));
+    stats = s_stats;
+    portEXIT_CRITICAL(&s_lock);
+
+    int64_t now = esp_timer_get_time();
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        if (entries[i].host[0] == '\0') {
+            continue;
+        }
+        char text[16];
+        inet_ntoa_r(entries[i].addr, text, sizeof(text));
+        int64_t ttl_s = (entries[i].expires_us - now) / 1000000;
+        if (ttl_s > 0) {
+            fprintf(stream, "%-24s %-15s ttl %lld s\n", entries[i].host, text, ttl_s);
+        } else {
+            fprintf(stream, "%-24s %-15s expired\n", entries[i].host, text);
+        }
+    }
+    fprintf(stream, "hits %lu, misses %lu, stale %lu, failures %lu\n",
+            stats.hits, stats.misses, stats.stale_hits, stats.failures);
+    fprintf(stream, "lookup avg %lu us (max %lu)\n", stats.avg_lookup_us, stats.max_lookup_us);
+}
@@ -0,0 +1,39 @@
+#ifndef DNS_CACHE_H
+#define DNS_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "esp_err.h"
+#include "lwip/sockets.h"
+
+// 小型DNS缓存：天气客户端和网络诊断共用，避免每次建连、每次诊断都重新解析
+// getaddrinfo拿不到记录的TTL，统一按DNS_CACHE_TTL_S过期；过期后重新解析失败时继续用旧地址
+
+#define DNS_CACHE_SIZE  4
+#define DNS_CACHE_TTL_S (10 * 60)
+
+typedef struct {
+    uint32_t hits;            // 缓存命中
+    uint32_t misses;          // 未命中或已过期，需要解析
+    uint32_t stale_hits;      // 解析失败时用了过期的旧地址
+    uint32_t failures;        // 解析失败且没有旧地址
+    uint32_t avg_lookup_us;   // 实际解析（getaddrinfo）的耗时
+    uint32_t max_lookup_us;
+} dns_cache_stats_t;
+
+// 查询主机的IPv4地址，未命中时阻塞解析（只能在任务中调用，不能在事件回调里调用）
+esp_err_t dns_cache_lookup(const char *host, struct in_addr *addr);
+
+// 连接失败时调用，下次查询重新解析
+void dns_cache_invalidate(const char *host);
+
+// 在网络核心上异步解析这些主机（名字必须是常量字符串），联网后立即调用
+void dns_cache_prefetch(const char *const *hosts, size_t count);
+
+void dns_cache_get_stats(dns_cache_stats_t *stats);
+
+// 输出缓存条目和统计
+void dns_cache_dump(FILE *stream);
+
+#endif
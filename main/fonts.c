@@ -391,6 +391,23 @@ void lcd_draw_rect(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t w, uint1
     }
 }
 
+// 查找汉字字模，找不到返回NULL
+const chinese_char_t *find_chinese_char(const char *ch)
+{
+    if (ch == NULL) {
+        return NULL;
+    }
+
+    for (int i = 0; chinese_chars[i].bitmap != NULL; i++) {
+        if (chinese_chars[i].index[0] == ch[0] &&
+            chinese_chars[i].index[1] == ch[1] &&
+            chinese_chars[i].index[2] == ch[2]) {
+            return &chinese_chars[i];
+        }
+    }
+    return NULL;
+}
+
 // 绘制单个汉字
 void show_single_char(int x, int y, const char* ch, uint16_t color)
 {
@@ -405,37 +422,33 @@ void show_single_char(int x, int y, const char* ch, uint16_t color)
     }
     
     // 查找对应的汉字字模
-    for (int i = 0; chinese_chars[i].bitmap != NULL; i++) {
-        if (chinese_chars[i].index[0] == ch[0] && 
-            chinese_chars[i].index[1] == ch[1] && 
-            chinese_chars[i].index[2] == ch[2]) {
-            
-            const uint8_t *bitmap = chinese_chars[i].bitmap;
-            int width = chinese_chars[i].width;
+    const chinese_char_t *glyph = find_chinese_char(ch);
+    if (glyph != NULL) {
+        const uint8_t *bitmap = glyph->bitmap;
+        int width = glyph->width;
+        
+        ESP_LOGD(TAG, "Drawing char at (%d,%d), width=%d", x, y, width);
+        
+        // 绘制16x16点阵
+        for (int row = 0; row < 16; row++) {
+            uint8_t byte1 = bitmap[row * 2];     // 每行前8位
+            uint8_t byte2 = bitmap[row * 2 + 1]; // 每行后8位
             
-            ESP_LOGD(TAG, "Drawing char at (%d,%d), width=%d", x, y, width);
-            
-            // 绘制16x16点阵
-            for (int row = 0; row < 16; row++) {
-                uint8_t byte1 = bitmap[row * 2];     // 每行前8位
-                uint8_t byte2 = bitmap[row * 2 + 1]; // 每行后8位
-                
-                // 处理前8位
-                for (int col = 0; col < 8; col++) {
-                    if (byte1 & (0x80 >> col)) { // 从高位到低位
-                        lcd_draw_pixel(g_lcd, x + col, y + row, color);
-                    }
+            // 处理前8位
+            for (int col = 0; col < 8; col++) {
+                if (byte1 & (0x80 >> col)) { // 从高位到低位
+                    lcd_draw_pixel(g_lcd, x + col, y + row, color);
                 }
-                
-                // 处理后8位
-                for (int col = 0; col < 8; col++) {
-                    if (byte2 & (0x80 >> col)) {
-                        lcd_draw_pixel(g_lcd, x + col + 8, y + row, color);
-                    }
+            }
+            
+            // 处理后8位
+            for (int col = 0; col < 8; col++) {
+                if (byte2 & (0x80 >> col)) {
+                    lcd_draw_pixel(g_lcd, x + col + 8, y + row, color);
                 }
             }
-            return;
         }
+        return;
     }
     
     // 如果找不到汉字，绘制一个占位矩形
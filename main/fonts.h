@@ -15,6 +15,7 @@ typedef struct {
 void set_global_lcd(lcd_display_t *lcd);
 void show_custom_font(int x, int y, const char* str, uint16_t color);
 void show_single_char(int x, int y, const char* ch, uint16_t color);
+const chinese_char_t *find_chinese_char(const char *ch);
 void lcd_draw_rect(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
 
 // 外部字模声明
@@ -0,0 +1,327 @@
+#include "lcd_capture.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "mbedtls/base64.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "LCD_CAPTURE";
+
+// 需要解析的ST7735命令
+#define CAPTURE_CMD_CASET 0x2A
+#define CAPTURE_CMD_RASET 0x2B
+#define CAPTURE_CMD_RAMWR 0x2C
+#define CAPTURE_CMD_COLMOD 0x3A
+
+// base64每行编码的原始字节数（编码后64个字符）
+#define CAPTURE_B64_CHUNK 48
+
+// 影子帧缓冲：按照总线上的CASET/RASET/RAMWR数据流重建屏幕内容
+struct lcd_shadow {
+    uint16_t *fb;
+    uint8_t cmd;          // 最近一次命令
+    uint8_t args[4];      // CASET/RASET参数
+    uint8_t arg_len;
+    uint16_t x0, x1;      // 当前窗口（屏幕坐标）
+    uint16_t y0, y1;
+    uint16_t cx, cy;      // RAMWR写指针
+    bool twelve_bit;      // COLMOD为12位（两像素3字节）
+    uint8_t pending[2];   // 未凑满一个像素（或12位像素对）的字节
+    uint8_t pending_len;
+};
+
+esp_err_t lcd_capture_enable(lcd_display_t *lcd)
+{
+    if (lcd == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (lcd->shadow != NULL) {
+        return ESP_OK;
+    }
+
+    lcd_shadow_t *shadow = calloc(1, sizeof(lcd_shadow_t));
+    if (shadow == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    shadow->fb = calloc((size_t)lcd->width * lcd->height, sizeof(uint16_t));
+    if (shadow->fb == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate shadow framebuffer");
+        free(shadow);
+        return ESP_ERR_NO_MEM;
+    }
+    shadow->x1 = lcd->width - 1;
+    shadow->y1 = lcd->height - 1;
+    shadow->twelve_bit = lcd->color_mode == LCD_COLOR_MODE_12BIT;
+
+    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
+        lcd->shadow = shadow;
+        xSemaphoreGive(lcd->spi_mutex);
+    }
+
+    ESP_LOGI(TAG, "Frame capture enabled (%dx%d shadow framebuffer)", lcd->width, lcd->height);
+    return ESP_OK;
+}
+
+void lcd_capture_disable(lcd_display_t *lcd)
+{
+    if (lcd == NULL || lcd->shadow == NULL) {
+        return;
+    }
+
+    lcd_shadow_t *shadow = NULL;
+    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
+        shadow = lcd->shadow;
+        lcd->shadow = NULL;
+        xSemaphoreGive(lcd->spi_mutex);
+    }
+
+    if (shadow) {
+        free(shadow->fb);
+        free(shadow);
+    }
+}
+
+static void capture_put_pixel(lcd_display_t *lcd, lcd_shadow_t *shadow, uint16_t color)
+{
+    if (shadow->cx < lcd->width && shadow->cy < lcd->height) {
+        shadow->fb[shadow->cy * lcd->width + shadow->cx] = color;
+    }
+
+    // 与控制器一样：先按列推进，到窗口右边界换行，写满窗口后回到起点
+    if (++shadow->cx > shadow->x1) {
+        shadow->cx = shadow->x0;
+        if (++shadow->cy > shadow->y1) {
+            shadow->cy = shadow->y0;
+        }
+    }
+}
+
+static uint16_t rgb444_to_565(uint16_t c)
+{
+    uint16_t r = (c >> 8) & 0x0F;
+    uint16_t g = (c >> 4) & 0x0F;
+    uint16_t b = c & 0x0F;
+    return (((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3));
+}
+
+void lcd_capture_feed(lcd_display_t *lcd, bool is_data, const uint8_t *buf, size_t len)
+{
+    lcd_shadow_t *shadow = lcd->shadow;
+    if (shadow == NULL || buf == NULL || len == 0) {
+        return;
+    }
+
+    if (!is_data) {
+        shadow->cmd = buf[len - 1];
+        shadow->arg_len = 0;
+        if (shadow->cmd == CAPTURE_CMD_RAMWR) {
+            shadow->cx = shadow->x0;
+            shadow->cy = shadow->y0;
+            shadow->pending_len = 0;
+        }
+        return;
+    }
+
+    switch (shadow->cmd) {
+        case CAPTURE_CMD_CASET:
+        case CAPTURE_CMD_RASET:
+            for (size_t i = 0; i < len && shadow->arg_len < sizeof(shadow->args); i++) {
+                shadow->args[shadow->arg_len++] = buf[i];
+            }
+            if (shadow->arg_len == sizeof(shadow->args)) {
+                // 去掉GREENTAB3偏移，换算回屏幕坐标
+                uint8_t offset = shadow->cmd == CAPTURE_CMD_CASET ? lcd->x_offset : lcd->y_offset;
+                uint16_t start = ((shadow->args[0] << 8) | shadow->args[1]) - offset;
+                uint16_t end = ((shadow->args[2] << 8) | shadow->args[3]) - offset;
+                if (shadow->cmd == CAPTURE_CMD_CASET) {
+                    shadow->x0 = start;
+                    shadow->x1 = end;
+                } else {
+                    shadow->y0 = start;
+                    shadow->y1 = end;
+                }
+            }
+            break;
+
+        case CAPTURE_CMD_COLMOD:
+            shadow->twelve_bit = (buf[0] & 0x07) == 0x03;
+            break;
+
+        case CAPTURE_CMD_RAMWR:
+            for (size_t i = 0; i < len; i++) {
+                if (!shadow->twelve_bit) {
+                    if (shadow->pending_len == 0) {
+                        shadow->pending[shadow->pending_len++] = buf[i];
+                    } else {
+                        capture_put_pixel(lcd, shadow, (shadow->pending[0] << 8) | buf[i]);
+                        shadow->pending_len = 0;
+                    }
+                } else if (shadow->pending_len < 2) {
+                    shadow->pending[shadow->pending_len++] = buf[i];
+                } else {
+                    // 3字节还原成两个RGB444像素，再扩展回RGB565
+                    uint16_t a = (shadow->pending[0] << 4) | (shadow->pending[1] >> 4);
+                    uint16_t b = ((shadow->pending[1] & 0x0F) << 8) | buf[i];
+                    capture_put_pixel(lcd, shadow, rgb444_to_565(a));
+                    capture_put_pixel(lcd, shadow, rgb444_to_565(b));
+                    shadow->pending_len = 0;
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+uint32_t lcd_capture_crc32(lcd_display_t *lcd)
+{
+    if (lcd == NULL || lcd->shadow == NULL) {
+        return 0;
+    }
+
+    uint32_t crc = 0;
+    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
+        // 持锁后再检查：控制台可能刚关闭截图并释放了影子帧缓冲
+        if (lcd->shadow != NULL) {
+            crc = esp_rom_crc32_le(0, (const uint8_t *)lcd->shadow->fb,
+                                   (uint32_t)lcd->width * lcd->height * sizeof(uint16_t));
+        }
+        xSemaphoreGive(lcd->spi_mutex);
+    }
+    return crc;
+}
+
+esp_err_t lcd_capture_write_ppm(lcd_display_t *lcd, lcd_capture_sink_t sink, void *ctx)
+{
+    if (lcd == NULL || sink == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (lcd->shadow == NULL) {
+        ESP_LOGW(TAG, "Frame capture is not enabled");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    char header[24];
+    int header_len = snprintf(header, sizeof(header), "P6\n%d %d\n255\n", lcd->width, lcd->height);
+    esp_err_t ret = sink(ctx, (const uint8_t *)header, header_len);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // 一次只转换一行：每行只在复制时短暂持锁，不阻塞时钟刷新
+    uint8_t *row = malloc((size_t)lcd->width * 3);
+    if (row == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (int y = 0; y < lcd->height && ret == ESP_OK; y++) {
+        if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) != pdTRUE) {
+            ret = ESP_ERR_TIMEOUT;
+            break;
+        }
+        // 两行之间不持锁，截图可能被控制台关闭，影子帧缓冲随之释放
+        if (lcd->shadow == NULL) {
+            xSemaphoreGive(lcd->spi_mutex);
+            ESP_LOGW(TAG, "Frame capture disabled during export");
+            ret = ESP_ERR_INVALID_STATE;
+            break;
+        }
+        const uint16_t *src = &lcd->shadow->fb[y * lcd->width];
+        for (int x = 0; x < lcd->width; x++) {
+            uint16_t c = src[x];
+            // RGB565 -> RGB888（高位复制到低位，保证白色为255）
+            uint8_t r = (c >> 11) & 0x1F;
+            uint8_t g = (c >> 5) & 0x3F;
+            uint8_t b = c & 0x1F;
+            row[x * 3] = (r << 3) | (r >> 2);
+            row[x * 3 + 1] = (g << 2) | (g >> 4);
+            row[x * 3 + 2] = (b << 3) | (b >> 2);
+        }
+        xSemaphoreGive(lcd->spi_mutex);
+
+        ret = sink(ctx, row, (size_t)lcd->width * 3);
+    }
+
+    free(row);
+    return ret;
+}
+
+// 控制台输出：凑满48字节编码成一行base64
+typedef struct {
+    uint8_t pending[CAPTURE_B64_CHUNK];
+    size_t pending_len;
+} console_sink_t;
+
+static void console_flush_line(console_sink_t *cs)
+{
+    unsigned char line[CAPTURE_B64_CHUNK / 3 * 4 + 1];
+    size_t olen = 0;
+    if (mbedtls_base64_encode(line, sizeof(line), &olen, cs->pending, cs->pending_len) == 0) {
+        fwrite(line, 1, olen, stdout);
+        fputc('\n', stdout);
+    }
+    cs->pending_len = 0;
+}
+
+static esp_err_t console_sink(void *ctx, const uint8_t *data, size_t len)
+{
+    console_sink_t *cs = (console_sink_t *)ctx;
+    while (len > 0) {
+        size_t n = CAPTURE_B64_CHUNK - cs->pending_len;
+        if (n > len) n = len;
+        memcpy(cs->pending + cs->pending_len, data, n);
+        cs->pending_len += n;
+        data += n;
+        len -= n;
+        if (cs->pending_len == CAPTURE_B64_CHUNK) {
+            console_flush_line(cs);
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t lcd_capture_dump_console(lcd_display_t *lcd)
+{
+    console_sink_t cs = {0};
+    uint32_t crc = lcd_capture_crc32(lcd);
+
+    printf("-----BEGIN PPM FRAME crc=%08lx-----\n", crc);
+    esp_err_t ret = lcd_capture_write_ppm(lcd, console_sink, &cs);
+    if (cs.pending_len > 0) {
+        console_flush_line(&cs);
+    }
+    printf("-----END PPM FRAME-----\n");
+    fflush(stdout);
+
+    return ret;
+}
+
+static esp_err_t file_sink(void *ctx, const uint8_t *data, size_t len)
+{
+    return fwrite(data, 1, len, (FILE *)ctx) == len ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t lcd_capture_save_file(lcd_display_t *lcd, const char *path)
+{
+    if (path == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Failed to open %s", path);
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = lcd_capture_write_ppm(lcd, file_sink, f);
+    fclose(f);
+
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Frame saved to %s", path);
+    }
+    return ret;
+}
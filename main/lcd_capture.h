@@ -0,0 +1,34 @@
+#ifndef LCD_CAPTURE_H
+#define LCD_CAPTURE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "lcd_driver.h"
+
+// 截图数据输出回调（流式，每次只给出一小段数据）
+typedef esp_err_t (*lcd_capture_sink_t)(void *ctx, const uint8_t *data, size_t len);
+
+// 开启截图功能：分配影子帧缓冲，之后所有RAMWR数据流都会同步记录下来
+esp_err_t lcd_capture_enable(lcd_display_t *lcd);
+
+// 关闭截图功能并释放影子帧缓冲
+void lcd_capture_disable(lcd_display_t *lcd);
+
+// 计算当前帧的CRC32（长时间测试中比较画面是否一致）
+uint32_t lcd_capture_crc32(lcd_display_t *lcd);
+
+// 以PPM(P6)格式逐行输出当前帧，不额外复制整帧
+esp_err_t lcd_capture_write_ppm(lcd_display_t *lcd, lcd_capture_sink_t sink, void *ctx);
+
+// 通过控制台输出base64编码的PPM（带起止标记，便于从串口日志中提取）
+esp_err_t lcd_capture_dump_console(lcd_display_t *lcd);
+
+// 保存PPM到文件（需要挂载了文件系统）
+esp_err_t lcd_capture_save_file(lcd_display_t *lcd, const char *path);
+
+// 驱动内部调用：记录发送到总线上的命令/数据（调用时已持有spi_mutex）
+void lcd_capture_feed(lcd_display_t *lcd, bool is_data, const uint8_t *buf, size_t len);
+
+#endif
@@ -5,7 +5,13 @@
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include <stdlib.h>
+#include <string.h>
 #include "fonts.h"
+#include "lcd_capture.h"
+#include "trace.h"
 
 static const char *TAG = "LCD_DRIVER";
 
@@ -37,6 +43,9 @@ static const char *TAG = "LCD_DRIVER";
 #define ST7735_GMCTRP1 0xE0
 #define ST7735_GMCTRN1 0xE1
 
+// 批量写像素时的DMA缓冲区大小（字节）
+#define LCD_TX_BUF_SIZE 1024
+
 // 8x16 字体数据
 const uint8_t font_8x16_data[] = {
     // 每个字符16个字节，共95个字符（ASCII 32-126）
@@ -1386,6 +1395,199 @@ static void lcd_spi_pre_transfer_callback(spi_transaction_t *t)
     }
 }
 
+// 总线写入（调用者必须已持有spi_mutex），所有命令和像素数据都经过这里，便于统计和截图
+static esp_err_t lcd_bus_write_locked(lcd_display_t *lcd, bool is_data, const void *buf, size_t len)
+{
+    spi_transaction_t t = {
+        .length = len * 8,
+        .tx_buffer = buf,
+        .user = (void *)lcd,
+        .cmd = is_data ? 1 : 0, // DC线: 0命令, 1数据
+    };
+    esp_err_t ret = spi_device_polling_transmit(lcd->spi, &t);
+    if (ret == ESP_OK) {
+        lcd->bus_bytes += len;
+#if CONFIG_LCD_FRAME_CAPTURE
+        if (lcd->shadow) {
+            lcd_capture_feed(lcd, is_data, (const uint8_t *)buf, len);
+        }
+#endif
+    }
+    return ret;
+}
+
+// 设置显示窗口（调用者必须已持有spi_mutex）
+static esp_err_t lcd_set_window_locked(lcd_display_t *lcd, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    // 应用GREENTAB3偏移量
+    x0 += lcd->x_offset;
+    x1 += lcd->x_offset;
+    y0 += lcd->y_offset;
+    y1 += lcd->y_offset;
+    
+    // 确保坐标在有效范围内
+    if (x1 >= lcd->width + lcd->x_offset) x1 = lcd->width + lcd->x_offset - 1;
+    if (y1 >= lcd->height + lcd->y_offset) y1 = lcd->height + lcd->y_offset - 1;
+    
+    uint8_t caset[4] = { x0 >> 8, x0 & 0xFF, x1 >> 8, x1 & 0xFF };
+    uint8_t raset[4] = { y0 >> 8, y0 & 0xFF, y1 >> 8, y1 & 0xFF };
+    uint8_t cmd;
+    esp_err_t ret;
+    
+    cmd = ST7735_CASET;
+    ret = lcd_bus_write_locked(lcd, false, &cmd, 1);
+    if (ret == ESP_OK) ret = lcd_bus_write_locked(lcd, true, caset, sizeof(caset));
+    
+    cmd = ST7735_RASET;
+    if (ret == ESP_OK) ret = lcd_bus_write_locked(lcd, false, &cmd, 1);
+    if (ret == ESP_OK) ret = lcd_bus_write_locked(lcd, true, raset, sizeof(raset));
+    
+    cmd = ST7735_RAMWR;
+    if (ret == ESP_OK) ret = lcd_bus_write_locked(lcd, false, &cmd, 1);
+    
+    return ret;
+}
+
+// RGB565 -> RGB444（取各分量高4位）
+#define RGB565_TO_444(c) ((((c) >> 4) & 0xF00) | (((c) >> 3) & 0x0F0) | (((c) >> 1) & 0x00F))
+
+// 12位打包：两个像素打包成3字节 RRRRGGGG BBBBRRRR GGGGBBBB
+static inline void lcd_pack_444_pair(uint8_t *dst, uint16_t a, uint16_t b)
+{
+    uint16_t pa = RGB565_TO_444(a);
+    uint16_t pb = RGB565_TO_444(b);
+    dst[0] = pa >> 4;
+    dst[1] = ((pa & 0x0F) << 4) | (pb >> 8);
+    dst[2] = pb & 0xFF;
+}
+
+// 像素写入器：按当前颜色模式把RGB565像素打包进tx_buf，满了就发送（调用者必须已持有spi_mutex并设置好窗口）
+typedef struct {
+    lcd_display_t *lcd;
+    uint32_t fill;      // tx_buf已用字节数
+    uint16_t first;     // 窗口第一个像素（12位模式奇数像素补齐用）
+    uint16_t half;      // 12位模式下等待配对的像素
+    bool has_first;
+    bool has_half;
+    esp_err_t ret;
+} lcd_px_writer_t;
+
+static void lcd_px_writer_begin(lcd_px_writer_t *w, lcd_display_t *lcd)
+{
+    w->lcd = lcd;
+    w->fill = 0;
+    w->first = 0;
+    w->half = 0;
+    w->has_first = false;
+    w->has_half = false;
+    w->ret = ESP_OK;
+}
+
+static inline void lcd_px_writer_flush(lcd_px_writer_t *w)
+{
+    if (w->ret == ESP_OK && w->fill > 0) {
+        w->ret = lcd_bus_write_locked(w->lcd, true, w->lcd->tx_buf, w->fill);
+    }
+    w->fill = 0;
+}
+
+static inline void lcd_px_writer_put(lcd_px_writer_t *w, uint16_t color)
+{
+    if (!w->has_first) {
+        w->first = color;
+        w->has_first = true;
+    }
+
+    if (w->lcd->color_mode == LCD_COLOR_MODE_12BIT) {
+        if (!w->has_half) {
+            w->half = color;
+            w->has_half = true;
+            return;
+        }
+        if (w->fill + 3 > LCD_TX_BUF_SIZE) lcd_px_writer_flush(w);
+        lcd_pack_444_pair(&w->lcd->tx_buf[w->fill], w->half, color);
+        w->fill += 3;
+        w->has_half = false;
+    } else {
+        if (w->fill + 2 > LCD_TX_BUF_SIZE) lcd_px_writer_flush(w);
+        w->lcd->tx_buf[w->fill++] = color >> 8;
+        w->lcd->tx_buf[w->fill++] = color & 0xFF;
+    }
+}
+
+// 批量写入连续像素（整块数组走成对打包的快速路径）
+static void lcd_px_writer_put_run(lcd_px_writer_t *w, const uint16_t *pixels, uint32_t count)
+{
+    if (count == 0) return;
+
+    if (!w->has_first) {
+        w->first = pixels[0];
+        w->has_first = true;
+    }
+
+    if (w->lcd->color_mode != LCD_COLOR_MODE_12BIT) {
+        while (count > 0 && w->ret == ESP_OK) {
+            uint32_t n = (LCD_TX_BUF_SIZE - w->fill) / 2;
+            if (n == 0) {
+                lcd_px_writer_flush(w);
+                continue;
+            }
+            if (n > count) n = count;
+            uint8_t *dst = &w->lcd->tx_buf[w->fill];
+            for (uint32_t i = 0; i < n; i++) {
+                dst[i * 2] = pixels[i] >> 8;
+                dst[i * 2 + 1] = pixels[i] & 0xFF;
+            }
+            w->fill += n * 2;
+            pixels += n;
+            count -= n;
+        }
+        return;
+    }
+
+    // 先把上次剩下的半对补齐
+    if (w->has_half) {
+        lcd_px_writer_put(w, pixels[0]);
+        pixels++;
+        count--;
+    }
+    while (count >= 2 && w->ret == ESP_OK) {
+        uint32_t pairs = (LCD_TX_BUF_SIZE - w->fill) / 3;
+        if (pairs == 0) {
+            lcd_px_writer_flush(w);
+            continue;
+        }
+        if (pairs > count / 2) pairs = count / 2;
+        uint8_t *dst = &w->lcd->tx_buf[w->fill];
+        for (uint32_t i = 0; i < pairs; i++) {
+            lcd_pack_444_pair(dst, pixels[0], pixels[1]);
+            dst += 3;
+            pixels += 2;
+        }
+        w->fill += pairs * 3;
+        count -= pairs * 2;
+    }
+    if (count > 0) {
+        lcd_px_writer_put(w, pixels[0]);
+    }
+}
+
+// 结束写入。12位模式下像素数为奇数时，用窗口第一个像素补齐最后一对：
+// 多出的像素会回绕写到窗口起点，写入的正好是它原来的颜色
+static esp_err_t lcd_px_writer_end(lcd_px_writer_t *w)
+{
+    if (w->has_half) {
+        if (w->fill + 3 > LCD_TX_BUF_SIZE) lcd_px_writer_flush(w);
+        lcd_pack_444_pair(&w->lcd->tx_buf[w->fill], w->half, w->first);
+        w->fill += 3;
+        w->has_half = false;
+    }
+    lcd_px_writer_flush(w);
+    return w->ret;
+}
+
+static void lcd_set_window(lcd_display_t *lcd, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
 esp_err_t lcd_init(lcd_display_t *lcd, const lcd_config_t *config)
 {
     esp_err_t ret;
@@ -1466,6 +1668,19 @@ esp_err_t lcd_init(lcd_display_t *lcd, const lcd_config_t *config)
         return ESP_FAIL;
     }
     
+    // 分配批量写像素用的DMA缓冲区
+    lcd->bus_bytes = 0;
+    lcd->shadow = NULL;
+    lcd->color_mode = config->color_mode;
+    lcd->tx_buf = heap_caps_malloc(LCD_TX_BUF_SIZE, MALLOC_CAP_DMA);
+    if (lcd->tx_buf == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate SPI TX buffer");
+        vSemaphoreDelete(lcd->spi_mutex);
+        spi_bus_remove_device(lcd->spi);
+        spi_bus_free(SPI2_HOST);
+        return ESP_ERR_NO_MEM;
+    }
+    
     // 硬件复位
     gpio_set_level(lcd->rst_pin, 0);
     vTaskDelay(100 / portTICK_PERIOD_MS);
@@ -1537,7 +1752,7 @@ esp_err_t lcd_init(lcd_display_t *lcd, const lcd_config_t *config)
     
     // 接口像素格式
     lcd_send_command(lcd, ST7735_COLMOD);
-    lcd_send_data(lcd, 0x05);  // 16位像素
+    lcd_send_data(lcd, lcd->color_mode == LCD_COLOR_MODE_12BIT ? 0x03 : 0x05);  // 12位/16位像素
     
     // 伽马校正 - 这是解决颜色问题的关键
     lcd_send_command(lcd, ST7735_GMCTRP1);
@@ -1578,13 +1793,7 @@ void lcd_send_command(lcd_display_t *lcd, uint8_t cmd)
     }
 
     if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
-        spi_transaction_t t = {
-            .length = 8,
-            .tx_buffer = &cmd,
-            .user = (void *)lcd,
-            .cmd = 0, // DC线为0表示命令
-        };
-        spi_device_polling_transmit(lcd->spi, &t);
+        lcd_bus_write_locked(lcd, false, &cmd, 1);
         xSemaphoreGive(lcd->spi_mutex);
     }
 }
@@ -1597,48 +1806,25 @@ void lcd_send_data(lcd_display_t *lcd, uint8_t data)
     }
 
     if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
-        spi_transaction_t t = {
-            .length = 8,
-            .tx_buffer = &data,
-            .user = (void *)lcd,
-            .cmd = 1, // DC线为1表示数据
-        };
-        spi_device_polling_transmit(lcd->spi, &t);
+        lcd_bus_write_locked(lcd, true, &data, 1);
         xSemaphoreGive(lcd->spi_mutex);
     }
 }
 
-void lcd_set_window(lcd_display_t *lcd, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+// 只在初始化时使用（此时还没有其他任务访问总线）。窗口命令和像素数据必须在同一次加锁内发送，
+// 否则动画任务可能在两者之间插入自己的窗口，所以绘制函数都用lcd_set_window_locked，不再对外提供
+static void lcd_set_window(lcd_display_t *lcd, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
     if (lcd == NULL) {
         ESP_LOGE(TAG, "LCD is NULL in lcd_set_window");
         return;
     }
     
-    // 应用GREENTAB3偏移量
-    x0 += lcd->x_offset;
-    x1 += lcd->x_offset;
-    y0 += lcd->y_offset;
-    y1 += lcd->y_offset;
-    
-    // 确保坐标在有效范围内
-    if (x1 >= lcd->width + lcd->x_offset) x1 = lcd->width + lcd->x_offset - 1;
-    if (y1 >= lcd->height + lcd->y_offset) y1 = lcd->height + lcd->y_offset - 1;
-    
 //    ESP_LOGI(TAG, "Setting window: (%d,%d) to (%d,%d)", x0, y0, x1, y1);
     
-    lcd_send_command(lcd, ST7735_CASET);
-    lcd_send_data(lcd, x0 >> 8);
-    lcd_send_data(lcd, x0 & 0xFF);
-    lcd_send_data(lcd, x1 >> 8);
-    lcd_send_data(lcd, x1 & 0xFF);
-    
-    lcd_send_command(lcd, ST7735_RASET);
-    lcd_send_data(lcd, y0 >> 8);
-    lcd_send_data(lcd, y0 & 0xFF);
-    lcd_send_data(lcd, y1 >> 8);
-    lcd_send_data(lcd, y1 & 0xFF);
-    
-    lcd_send_command(lcd, ST7735_RAMWR);
+    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
+        lcd_set_window_locked(lcd, x0, y0, x1, y1);
+        xSemaphoreGive(lcd->spi_mutex);
+    }
 }
 
 // 其他函数保持不变...
@@ -1646,9 +1832,15 @@ void lcd_draw_pixel(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t color)
 {
     if (x >= lcd->width || y >= lcd->height) return;
     
-    lcd_set_window(lcd, x, y, x, y);
-    lcd_send_data(lcd, color >> 8);
-    lcd_send_data(lcd, color & 0xFF);
+    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
+        lcd_px_writer_t w;
+        lcd_px_writer_begin(&w, lcd);
+        if (lcd_set_window_locked(lcd, x, y, x, y) == ESP_OK) {
+            lcd_px_writer_put(&w, color);
+            lcd_px_writer_end(&w);
+        }
+        xSemaphoreGive(lcd->spi_mutex);
+    }
 }
 
 void lcd_fill_rect(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
@@ -1658,20 +1850,16 @@ void lcd_fill_rect(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t w, uint1
     if (x + w > lcd->width) w = lcd->width - x;
     if (y + h > lcd->height) h = lcd->height - y;
 
-    lcd_set_window(lcd, x, y, x + w - 1, y + h - 1);
-
     uint32_t pixels = w * h;
-    uint8_t color_buffer[2] = { color >> 8, color & 0xFF };
 
     if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
-        for (uint32_t i = 0; i < pixels; i++) {
-            spi_transaction_t t = {
-                .length = 16,
-                .tx_buffer = color_buffer,
-                .user = (void *)lcd,
-                .cmd = 1,
-            };
-            spi_device_polling_transmit(lcd->spi, &t);
+        lcd_px_writer_t wr;
+        lcd_px_writer_begin(&wr, lcd);
+        if (lcd_set_window_locked(lcd, x, y, x + w - 1, y + h - 1) == ESP_OK) {
+            for (uint32_t i = 0; i < pixels && wr.ret == ESP_OK; i++) {
+                lcd_px_writer_put(&wr, color);
+            }
+            lcd_px_writer_end(&wr);
         }
         xSemaphoreGive(lcd->spi_mutex);
     }
@@ -1884,30 +2072,183 @@ void lcd_draw_image(lcd_display_t *lcd, int x, int y, int width, int height, con
         return;
     }
     
-    ESP_LOGI(TAG, "Drawing image at (%d,%d) size %dx%d with offsets x=%d, y=%d", 
-             x, y, width, height, lcd->x_offset, lcd->y_offset);
+    // 热路径只记一条跟踪记录，不再格式化日志
+    int64_t t0 = esp_timer_get_time();
+    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
+        // 设置显示窗口（应用偏移），像素按当前颜色模式打包后分块发送
+        lcd_px_writer_t w;
+        lcd_px_writer_begin(&w, lcd);
+        if (lcd_set_window_locked(lcd, x, y, x + width - 1, y + height - 1) == ESP_OK) {
+            lcd_px_writer_put_run(&w, image, (uint32_t)width * height);
+            lcd_px_writer_end(&w);
+        }
+        xSemaphoreGive(lcd->spi_mutex);
+    }
+    
+    TRACE(TRACE_EV_IMAGE_DRAW, TRACE_U16(esp_timer_get_time() - t0),
+          TRACE_PACK(x, y), TRACE_PACK(width, height));
+}
+
+esp_err_t lcd_write_region(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels)
+{
+    if (lcd == NULL || lcd->spi == NULL || pixels == NULL || w == 0 || h == 0) {
+        ESP_LOGE(TAG, "Invalid parameters in lcd_write_region");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (x + w > lcd->width || y + h > lcd->height) {
+        ESP_LOGE(TAG, "Region out of screen: %dx%d at (%d,%d)", w, h, x, y);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (lcd->tx_buf == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    
+    // 窗口设置和像素数据在同一次加锁内完成，避免其他任务插入窗口命令
+    esp_err_t ret = lcd_set_window_locked(lcd, x, y, x + w - 1, y + h - 1);
     
-    // 设置显示窗口（应用偏移）
-    lcd_set_window(lcd, x, y, x + width - 1, y + height - 1);
+    // 按当前颜色模式打包（16位转大端，12位两像素打包成3字节）
+    if (ret == ESP_OK) {
+        lcd_px_writer_t wr;
+        lcd_px_writer_begin(&wr, lcd);
+        lcd_px_writer_put_run(&wr, pixels, (uint32_t)w * h);
+        ret = lcd_px_writer_end(&wr);
+    }
     
-    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
-        for (int i = 0; i < width * height; i++) {
-            uint16_t color = image[i];
-            // 颜色转换：RGB565 -> BGR565
-            uint16_t bgr_color = ((color & 0x00FF) << 8) | ((color & 0xFF00) >> 8);
+    xSemaphoreGive(lcd->spi_mutex);
+    
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Region write failed: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+esp_err_t lcd_blit_atlas(lcd_display_t *lcd, const lcd_atlas_t *atlas, const lcd_rect_t *src, uint16_t x, uint16_t y)
+{
+    if (lcd == NULL || lcd->spi == NULL || atlas == NULL || atlas->pixels == NULL || src == NULL) {
+        ESP_LOGE(TAG, "Invalid parameters in lcd_blit_atlas");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (src->width == 0 || src->height == 0 ||
+        src->x + src->width > atlas->width || src->y + src->height > atlas->height) {
+        ESP_LOGE(TAG, "Source rect out of atlas: %dx%d at (%d,%d)", src->width, src->height, src->x, src->y);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (x + src->width > lcd->width || y + src->height > lcd->height) {
+        ESP_LOGE(TAG, "Blit out of screen: %dx%d at (%d,%d)", src->width, src->height, x, y);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (lcd->tx_buf == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    
+    esp_err_t ret = lcd_set_window_locked(lcd, x, y, x + src->width - 1, y + src->height - 1);
+    
+    // 逐行合成透明像素（取背景图对应位置），缓冲区满了就发送
+    if (ret == ESP_OK) {
+        lcd_px_writer_t w;
+        lcd_px_writer_begin(&w, lcd);
+        for (uint16_t row = 0; row < src->height && w.ret == ESP_OK; row++) {
+            const uint16_t *src_row = &atlas->pixels[(src->y + row) * atlas->width + src->x];
+            const uint16_t *bg_row = &thunderGod[(y + row) * 128 + x];
             
-            spi_transaction_t t = {
-                .length = 16,
-                .tx_buffer = &bgr_color,
-                .user = (void *)lcd,
-                .cmd = 1,
-            };
-            spi_device_polling_transmit(lcd->spi, &t);
+            for (uint16_t col = 0; col < src->width; col++) {
+                uint16_t color = src_row[col];
+                lcd_px_writer_put(&w, color == atlas->transparent ? bg_row[col] : color);
+            }
         }
-        xSemaphoreGive(lcd->spi_mutex);
+        ret = lcd_px_writer_end(&w);
     }
     
-    ESP_LOGI(TAG, "Image display completed");
+    xSemaphoreGive(lcd->spi_mutex);
+    
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Atlas blit failed: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+esp_err_t lcd_set_color_mode(lcd_display_t *lcd, lcd_color_mode_t mode)
+{
+    if (lcd == NULL || lcd->spi == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t cmd = ST7735_COLMOD;
+    uint8_t data = mode == LCD_COLOR_MODE_12BIT ? 0x03 : 0x05;
+    esp_err_t ret = ESP_FAIL;
+
+    // 模式切换和后续像素写入都在spi_mutex下进行，不会出现按旧格式打包的数据
+    if (xSemaphoreTake(lcd->spi_mutex, portMAX_DELAY) == pdTRUE) {
+        ret = lcd_bus_write_locked(lcd, false, &cmd, 1);
+        if (ret == ESP_OK) ret = lcd_bus_write_locked(lcd, true, &data, 1);
+        if (ret == ESP_OK) lcd->color_mode = mode;
+        xSemaphoreGive(lcd->spi_mutex);
+    }
+    return ret;
+}
+
+void lcd_benchmark_color_modes(lcd_display_t *lcd, int iterations)
+{
+    if (lcd == NULL || iterations <= 0) return;
+
+    // 局部刷新取天气区域大小（64x32），数据来自背景图
+    const uint16_t region_w = 64, region_h = 32;
+    uint16_t *region = malloc(region_w * region_h * sizeof(uint16_t));
+    if (region == NULL) {
+        ESP_LOGE(TAG, "Benchmark: failed to allocate region buffer");
+        return;
+    }
+    for (int row = 0; row < region_h; row++) {
+        memcpy(&region[row * region_w], &thunderGod[(5 + row) * 128 + 64], region_w * sizeof(uint16_t));
+    }
+
+    lcd_color_mode_t saved_mode = lcd->color_mode;
+    const lcd_color_mode_t modes[2] = { LCD_COLOR_MODE_16BIT, LCD_COLOR_MODE_12BIT };
+
+    for (int m = 0; m < 2; m++) {
+        lcd_set_color_mode(lcd, modes[m]);
+
+        uint32_t bytes = lcd->bus_bytes;
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < iterations; i++) {
+            lcd_draw_image(lcd, 0, 0, lcd->width, lcd->height, thunderGod);
+        }
+        int64_t full_us = (esp_timer_get_time() - start) / iterations;
+        uint32_t full_bytes = (lcd->bus_bytes - bytes) / iterations;
+
+        bytes = lcd->bus_bytes;
+        start = esp_timer_get_time();
+        for (int i = 0; i < iterations; i++) {
+            lcd_write_region(lcd, 64, 5, region_w, region_h, region);
+        }
+        int64_t region_us = (esp_timer_get_time() - start) / iterations;
+        uint32_t region_bytes = (lcd->bus_bytes - bytes) / iterations;
+
+        bytes = lcd->bus_bytes;
+        start = esp_timer_get_time();
+        for (int i = 0; i < iterations; i++) {
+            lcd_fill_rect(lcd, 64, 5, region_w, region_h, COLOR_BLACK);
+        }
+        int64_t fill_us = (esp_timer_get_time() - start) / iterations;
+        uint32_t fill_bytes = (lcd->bus_bytes - bytes) / iterations;
+
+        ESP_LOGI(TAG, "Benchmark %s: full screen %lld us (%lu B), region %dx%d %lld us (%lu B), fill %lld us (%lu B)",
+                 modes[m] == LCD_COLOR_MODE_12BIT ? "12-bit" : "16-bit",
+                 full_us, full_bytes, region_w, region_h, region_us, region_bytes, fill_us, fill_bytes);
+    }
+
+    // 恢复原来的颜色模式和背景
+    lcd_set_color_mode(lcd, saved_mode);
+    lcd_draw_image(lcd, 0, 0, lcd->width, lcd->height, thunderGod);
+    free(region);
 }
 
 esp_err_t lcd_save_text_area_bg(lcd_display_t *lcd, text_area_bg_t *area) {
@@ -1948,93 +2289,35 @@ esp_err_t lcd_restore_text_area_bg(lcd_display_t *lcd, text_area_bg_t *area) {
         return ESP_ERR_INVALID_ARG;
     }
 
-    ESP_LOGI(TAG, "Restoring background: %dx%d at (%d,%d)", 
-             area->width, area->height, area->x, area->y);
+    int64_t t0 = esp_timer_get_time();
 
-    // 设置显示窗口
-    lcd_set_window(lcd, area->x, area->y, area->x + area->width - 1, area->y + area->height - 1);
-    
-    ESP_LOGI(TAG, "Window set completed, acquiring SPI mutex...");
-    
     // 尝试获取互斥锁，设置超时时间
-    if (xSemaphoreTake(lcd->spi_mutex, pdMS_TO_TICKS(5000)) == pdTRUE) {
-        esp_err_t ret = ESP_OK;
-        
-        ESP_LOGI(TAG, "SPI mutex acquired, sending RAMWR command...");
-        
-        // 使用更简单的方法发送RAMWR命令
-        spi_transaction_t t_cmd = {
-            .length = 8,
-            .tx_buffer = (uint8_t[]){ST7735_RAMWR},
-            .user = (void *)lcd,
-            .cmd = 0, // DC线为0表示命令
-        };
-        
-        ret = spi_device_polling_transmit(lcd->spi, &t_cmd);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to send RAMWR command: %s", esp_err_to_name(ret));
-            xSemaphoreGive(lcd->spi_mutex);
-            return ret;
-        }
-        
-        ESP_LOGI(TAG, "RAMWR command sent successfully, sending pixel data...");
-        
-        // 发送像素数据 - 使用更简单的方法，逐像素发送
-        uint32_t pixel_count = area->width * area->height;
-        ESP_LOGI(TAG, "Sending %lu pixels...", pixel_count);
-        
-        for (uint32_t i = 0; i < pixel_count; i++) {
-            uint16_t color = area->buffer[i];
-            uint8_t color_high = color >> 8;
-            uint8_t color_low = color & 0xFF;
-            
-            // 发送高字节
-            spi_transaction_t t_high = {
-                .length = 8,
-                .tx_buffer = &color_high,
-                .user = (void *)lcd,
-                .cmd = 1, // DC线为1表示数据
-            };
-            
-            ret = spi_device_polling_transmit(lcd->spi, &t_high);
-            if (ret != ESP_OK) {
-                ESP_LOGE(TAG, "Failed to send high byte at index %lu: %s", i, esp_err_to_name(ret));
-                break;
-            }
-            
-            // 发送低字节
-            spi_transaction_t t_low = {
-                .length = 8,
-                .tx_buffer = &color_low,
-                .user = (void *)lcd,
-                .cmd = 1, // DC线为1表示数据
-            };
-            
-            ret = spi_device_polling_transmit(lcd->spi, &t_low);
-            if (ret != ESP_OK) {
-                ESP_LOGE(TAG, "Failed to send low byte at index %lu: %s", i, esp_err_to_name(ret));
-                break;
-            }
-            
-            // 每发送100个像素添加一个延迟，避免SPI过载
-            if (i % 100 == 0) {
-                vTaskDelay(1 / portTICK_PERIOD_MS);
-            }
-        }
-        
-        xSemaphoreGive(lcd->spi_mutex);
-        
-        if (ret == ESP_OK) {
-            ESP_LOGI(TAG, "Background restored successfully, sent %lu pixels", pixel_count);
-        } else {
-            ESP_LOGE(TAG, "Failed to restore background after %lu pixels", pixel_count);
-        }
-        
-        return ret;
-    } else {
+    if (xSemaphoreTake(lcd->spi_mutex, pdMS_TO_TICKS(5000)) != pdTRUE) {
         ESP_LOGE(TAG, "Failed to acquire SPI mutex within 5 second timeout");
         return ESP_ERR_TIMEOUT;
     }
+    
+    // 窗口设置与像素数据在同一次加锁内完成，像素按当前颜色模式批量打包发送
+    uint32_t pixel_count = area->width * area->height;
+    esp_err_t ret = lcd_set_window_locked(lcd, area->x, area->y,
+                                          area->x + area->width - 1, area->y + area->height - 1);
+    if (ret == ESP_OK) {
+        lcd_px_writer_t w;
+        lcd_px_writer_begin(&w, lcd);
+        lcd_px_writer_put_run(&w, area->buffer, pixel_count);
+        ret = lcd_px_writer_end(&w);
+    }
+    
+    xSemaphoreGive(lcd->spi_mutex);
+    
+    if (ret == ESP_OK) {
+        TRACE(TRACE_EV_BG_RESTORE, TRACE_U16(esp_timer_get_time() - t0),
+              TRACE_PACK(area->x, area->y), TRACE_PACK(area->width, area->height));
+    } else {
+        ESP_LOGE(TAG, "Failed to restore background: %s", esp_err_to_name(ret));
+    }
+    
+    return ret;
 }
 
 text_area_bg_t* lcd_init_text_area(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
@@ -14,6 +14,7 @@
 #define COLOR_CYAN    0x07FF
 #define COLOR_YELLOW  0xFFE0
 #define COLOR_MAGENTA 0xF81F
+#define COLOR_GRAY    0x8410
 
 // ST7735_GREENTAB3 偏移量定义
 #define ST7735_GREENTAB3_X_OFFSET 2
@@ -43,6 +44,28 @@ typedef struct {
     uint16_t *buffer;     // 背景缓存数据
 } text_area_bg_t;
 
+// 矩形区域（精灵图源矩形等）
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+} lcd_rect_t;
+
+// 精灵图集：多张图标打包在一张RGB565图片里
+typedef struct {
+    const uint16_t *pixels;  // 图集像素数据
+    uint16_t width;          // 图集宽度
+    uint16_t height;         // 图集高度
+    uint16_t transparent;    // 透明色，透明像素显示背景图
+} lcd_atlas_t;
+
+// 像素传输格式（COLMOD）
+typedef enum {
+    LCD_COLOR_MODE_16BIT = 0,  // RGB565，每像素2字节
+    LCD_COLOR_MODE_12BIT,      // RGB444，每两个像素3字节，总线字节减少25%
+} lcd_color_mode_t;
+
 // LCD配置结构体
 typedef struct {
     int miso_io_num;
@@ -55,8 +78,12 @@ typedef struct {
     int width;
     int height;
     bool invert_colors;
+    lcd_color_mode_t color_mode;  // 初始像素传输格式，默认16位
 } lcd_config_t;
 
+// 影子帧缓冲（截图用，定义见lcd_capture.c）
+typedef struct lcd_shadow lcd_shadow_t;
+
 // LCD显示结构体
 typedef struct {
     spi_device_handle_t spi;
@@ -72,6 +99,10 @@ typedef struct {
     SemaphoreHandle_t spi_mutex;
     uint8_t x_offset;
     uint8_t y_offset;
+    uint8_t *tx_buf;      // DMA发送缓冲区（批量写像素用）
+    uint32_t bus_bytes;   // SPI总线累计发送字节数（统计用）
+    lcd_shadow_t *shadow; // 影子帧缓冲，未开启截图时为NULL
+    lcd_color_mode_t color_mode; // 当前像素传输格式
 } lcd_display_t;
 
 // 字体变量声明
@@ -84,7 +115,6 @@ extern font_t font_xstandard;
 esp_err_t lcd_init(lcd_display_t *lcd, const lcd_config_t *config);
 void lcd_send_command(lcd_display_t *lcd, uint8_t cmd);
 void lcd_send_data(lcd_display_t *lcd, uint8_t data);
-void lcd_set_window(lcd_display_t *lcd, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 void lcd_draw_pixel(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t color);
 void lcd_fill_rect(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
 void lcd_fill_screen(lcd_display_t *lcd, uint16_t color);
@@ -97,6 +127,14 @@ void lcd_set_text_color(lcd_display_t *lcd, uint16_t color);
 void lcd_set_bg_color(lcd_display_t *lcd, uint16_t color); // 新增函数
 void lcd_set_custom_font(lcd_display_t *lcd, void (*draw_func)(int x, int y, const char* str, uint16_t color));
 void lcd_draw_image(lcd_display_t *lcd, int x, int y, int width, int height, const uint16_t *image);
+// 批量写入矩形区域像素（一次设置窗口，分块DMA发送，窗口设置与数据在同一次加锁内完成）
+esp_err_t lcd_write_region(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels);
+// 从图集中取源矩形绘制到(x, y)，透明像素与背景图合成后一次窗口写入
+esp_err_t lcd_blit_atlas(lcd_display_t *lcd, const lcd_atlas_t *atlas, const lcd_rect_t *src, uint16_t x, uint16_t y);
+// 切换像素传输格式（可以按配置固定，也可以在单次操作前后切换）
+esp_err_t lcd_set_color_mode(lcd_display_t *lcd, lcd_color_mode_t mode);
+// 对比16位/12位模式下全屏和局部刷新的耗时与总线字节数，结果输出到日志
+void lcd_benchmark_color_modes(lcd_display_t *lcd, int iterations);
 void lcd_validate_fonts(void);
 
 // 获取字符串宽度（用于布局计算）
@@ -0,0 +1,382 @@
+#include "lcd_ticker.h"
+#include "fonts.h"
+#include "widget.h"
+#include "app_cores.h"
+#include "power_mgmt.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <string.h>
+
+static const char *TAG = "LCD_TICKER";
+
+// 当前MADCTL(0xC8)下控制器的硬件垂直滚动(VSCRDEF/VSCSAD)只能沿屏幕竖直方向滚动整行，
+// 水平字幕无法使用，因此采用离屏字条：文本预先渲染成列掩码，每步只重发内容发生变化的列
+
+#define TICKER_MAX_WIDTH        128
+#define TICKER_MAX_COLUMNS      320                 // 字条最大列数（文本 + 循环间隔）
+#define TICKER_GAP_COLUMNS      24                  // 首尾之间的空白间隔
+#define TICKER_MERGE_GAP        4                   // 相隔不超过4列的变化列合并成一次窗口写入
+#define TICKER_STEP_PERIOD_US   (33333)             // 30Hz，每步移动1列
+#define TICKER_STATS_INTERVAL_US (10 * 1000 * 1000) // 10秒统计一次
+#define TICKER_TEXT_MAX         64
+
+// 任务通知位
+#define TICKER_EVT_TICK (1 << 0)
+#define TICKER_EVT_TEXT (1 << 1)
+
+static lcd_display_t *s_lcd = NULL;
+static uint16_t s_x = 0;
+static uint16_t s_y = 0;
+static uint16_t s_width = 0;
+static TaskHandle_t s_task = NULL;
+static esp_timer_handle_t s_timer = NULL;
+static SemaphoreHandle_t s_draw_lock = NULL;
+
+// 待显示的文本（由调用者写入，字幕任务读取）
+static portMUX_TYPE s_text_lock = portMUX_INITIALIZER_UNLOCKED;
+static char s_pending_text[TICKER_TEXT_MAX];
+static uint16_t s_pending_color = COLOR_WHITE;
+
+// 字条：每列16个像素用一个uint16_t表示，bit n对应第n行
+static uint16_t s_cols[TICKER_MAX_COLUMNS];
+static uint16_t s_len = 0;
+static uint16_t s_offset = 0;
+static uint16_t s_color = COLOR_WHITE;
+static bool s_active = false;
+static bool s_scrolling = false;
+static bool s_paused = false;   // 暂停期间不画任何东西（持s_draw_lock修改）
+
+// 列合成缓冲区
+static uint16_t s_run[TICKER_MAX_WIDTH * LCD_TICKER_HEIGHT];
+
+// 统计
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static lcd_ticker_stats_t s_stats = {0};
+static int64_t s_win_start_us = 0;
+static uint32_t s_win_steps = 0;
+static uint32_t s_win_bytes = 0;
+static uint32_t s_win_columns = 0;
+static uint32_t s_win_cpu_us = 0;
+
+// ---------------- 字条渲染 ----------------
+
+static void strip_put_cjk(const char *ch)
+{
+    const chinese_char_t *glyph = find_chinese_char(ch);
+
+    for (int col = 0; col < 16 && s_len < TICKER_MAX_COLUMNS; col++) {
+        uint16_t mask = 0;
+        if (glyph != NULL) {
+            for (int row = 0; row < 16; row++) {
+                uint8_t byte = glyph->bitmap[row * 2 + col / 8];
+                if (byte & (0x80 >> (col % 8))) {
+                    mask |= 1 << row;
+                }
+            }
+        } else {
+            // 字库中没有的汉字画一个占位框，与show_single_char一致
+            mask = (col == 0 || col == 15) ? 0xFFFF : 0x8001;
+        }
+        s_cols[s_len++] = mask;
+    }
+}
+
+static void strip_put_ascii(char c)
+{
+    if (c < 32 || c > 126) {
+        c = '?';
+    }
+    const uint8_t *glyph = &font_standard.data[(c - 32) * 16];
+
+    for (int col = 0; col < 8 && s_len < TICKER_MAX_COLUMNS; col++) {
+        uint16_t mask = 0;
+        for (int row = 0; row < 16; row++) {
+            if (glyph[row] & (0x80 >> col)) {
+                mask |= 1 << row;
+            }
+        }
+        s_cols[s_len++] = mask;
+    }
+}
+
+static void strip_render(const char *text)
+{
+    s_len = 0;
+
+    size_t len = strlen(text);
+    for (size_t i = 0; i < len; ) {
+        if ((uint8_t)text[i] >= 0x80 && i + 2 < len) {
+            strip_put_cjk(&text[i]);
+            i += 3;
+        } else {
+            strip_put_ascii(text[i]);
+            i++;
+        }
+    }
+
+    // 放不下时追加间隔，首尾相接循环滚动
+    s_scrolling = s_len > s_width;
+    if (s_scrolling) {
+        for (int i = 0; i < TICKER_GAP_COLUMNS && s_len < TICKER_MAX_COLUMNS; i++) {
+            s_cols[s_len++] = 0;
+        }
+    }
+}
+
+// 第i个可见列在偏移offset时的内容
+static uint16_t strip_column(uint16_t offset, uint16_t i)
+{
+    if (!s_scrolling) {
+        return i < s_len ? s_cols[i] : 0;
+    }
+    return s_cols[(offset + i) % s_len];
+}
+
+// ---------------- 绘制 ----------------
+
+// 合成从第start列开始的count列（字色 + 背景图）并一次窗口写入
+static void write_columns(uint16_t start, uint16_t count)
+{
+    for (int row = 0; row < LCD_TICKER_HEIGHT; row++) {
+        const uint16_t *bg = &thunderGod[(s_y + row) * 128 + s_x + start];
+        uint16_t *dst = &s_run[row * count];
+        for (int i = 0; i < count; i++) {
+            dst[i] = (strip_column(s_offset, start + i) & (1 << row)) ? s_color : bg[i];
+        }
+    }
+    lcd_write_region(s_lcd, s_x + start, s_y, count, LCD_TICKER_HEIGHT, s_run);
+}
+
+// 前进一列，只重发与上一步不同的列，返回重发的列数
+static uint32_t step(void)
+{
+    uint16_t prev = s_offset;
+    s_offset = (s_offset + 1) % s_len;
+
+    uint32_t columns = 0;
+    int run_start = -1;
+    int last_changed = -1;
+
+    for (int i = 0; i <= s_width; i++) {
+        bool changed = i < s_width && strip_column(s_offset, i) != strip_column(prev, i);
+        if (changed) {
+            if (run_start < 0) {
+                run_start = i;
+            }
+            last_changed = i;
+            continue;
+        }
+        // 遇到足够长的不变区间（或行尾）时，把前面的变化列一次写出
+        if (run_start >= 0 && (i == s_width || i - last_changed > TICKER_MERGE_GAP)) {
+            write_columns(run_start, last_changed - run_start + 1);
+            columns += last_changed - run_start + 1;
+            run_start = -1;
+        }
+    }
+
+    return columns;
+}
+
+static void update_stats(uint32_t bytes, uint32_t columns, uint32_t cpu_us)
+{
+    s_win_steps++;
+    s_win_bytes += bytes;
+    s_win_columns += columns;
+    s_win_cpu_us += cpu_us;
+
+    int64_t now = esp_timer_get_time();
+    int64_t elapsed = now - s_win_start_us;
+    if (elapsed < TICKER_STATS_INTERVAL_US) return;
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.fps = s_win_steps * 1000000.0f / elapsed;
+    s_stats.avg_bus_bytes = s_win_bytes / s_win_steps;
+    s_stats.avg_columns = s_win_columns / s_win_steps;
+    s_stats.avg_cpu_us = s_win_cpu_us / s_win_steps;
+    s_stats.cpu_load = s_win_cpu_us * 100.0f / elapsed;
+    lcd_ticker_stats_t snapshot = s_stats;
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    ESP_LOGI(TAG, "Ticker: %.1f fps, %lu B/step, %lu cols/step, CPU %lu us/step, load %.2f%%",
+             snapshot.fps, snapshot.avg_bus_bytes, snapshot.avg_columns,
+             snapshot.avg_cpu_us, snapshot.cpu_load);
+
+    s_win_start_us = now;
+    s_win_steps = 0;
+    s_win_bytes = 0;
+    s_win_columns = 0;
+    s_win_cpu_us = 0;
+}
+
+// 读取新文本，整条重绘后决定是否开始滚动
+static void load_text(void)
+{
+    char text[TICKER_TEXT_MAX];
+
+    portENTER_CRITICAL(&s_text_lock);
+    memcpy(text, s_pending_text, sizeof(text));
+    s_color = s_pending_color;
+    portEXIT_CRITICAL(&s_text_lock);
+
+    esp_timer_stop(s_timer);
+    s_active = text[0] != '\0';
+    if (!s_active) {
+        s_scrolling = false;
+        return;
+    }
+
+    strip_render(text);
+    s_offset = 0;
+    write_columns(0, s_width);
+
+    if (s_scrolling) {
+        s_win_start_us = esp_timer_get_time();
+        s_win_steps = 0;
+        s_win_bytes = 0;
+        s_win_columns = 0;
+        s_win_cpu_us = 0;
+        esp_timer_start_periodic(s_timer, TICKER_STEP_PERIOD_US);
+    }
+}
+
+static void ticker_task(void *arg)
+{
+    while (1) {
+        uint32_t events = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+
+        // 渲染帧进行中时跳过滚动这一步，时钟控件优先
+        power_mgmt_acquire(POWER_LOCK_RENDER);
+        xSemaphoreTake(s_draw_lock, portMAX_DELAY);
+        if (s_paused) {
+            // 暂停期间的文本变化在恢复时统一处理
+        } else if (events & TICKER_EVT_TEXT) {
+            load_text();
+        } else if ((events & TICKER_EVT_TICK) && s_active && s_scrolling && !widget_frame_in_progress()) {
+            uint32_t bytes_before = s_lcd->bus_bytes;
+            int64_t start = esp_timer_get_time();
+            uint32_t columns = step();
+            uint32_t cpu_us = (uint32_t)(esp_timer_get_time() - start);
+            update_stats(s_lcd->bus_bytes - bytes_before, columns, cpu_us);
+        }
+        xSemaphoreGive(s_draw_lock);
+        power_mgmt_release(POWER_LOCK_RENDER);
+    }
+}
+
+static void ticker_timer_callback(void *arg)
+{
+    xTaskNotify(s_task, TICKER_EVT_TICK, eSetBits);
+}
+
+esp_err_t lcd_ticker_init(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t width)
+{
+    if (lcd == NULL || width == 0 || width > TICKER_MAX_WIDTH ||
+        x + width > lcd->width || y + LCD_TICKER_HEIGHT > lcd->height) {
+        ESP_LOGE(TAG, "Invalid parameters in lcd_ticker_init");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    s_lcd = lcd;
+    s_x = x;
+    s_y = y;
+    s_width = width;
+
+    s_draw_lock = xSemaphoreCreateMutex();
+    if (s_draw_lock == NULL) {
+        ESP_LOGE(TAG, "Failed to create ticker mutex");
+        return ESP_ERR_NO_MEM;
+    }
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = ticker_timer_callback,
+        .name = "lcd_ticker",
+        .skip_unhandled_events = true,
+    };
+    esp_err_t ret = esp_timer_create(&timer_args, &s_timer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create ticker timer: %s", esp_err_to_name(ret));
+        vSemaphoreDelete(s_draw_lock);
+        s_draw_lock = NULL;
+        return ret;
+    }
+
+    // 与天气动画同优先级，不抢占时钟刷新；和渲染任务在同一个核心上
+    if (xTaskCreatePinnedToCore(ticker_task, "lcd_ticker", 3072, NULL, tskIDLE_PRIORITY + 1,
+                                &s_task, APP_CORE_RENDER) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create ticker task");
+        esp_timer_delete(s_timer);
+        s_timer = NULL;
+        vSemaphoreDelete(s_draw_lock);
+        s_draw_lock = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Ticker ready at (%d,%d), width %d", x, y, width);
+    return ESP_OK;
+}
+
+void lcd_ticker_set_text(const char *text, uint16_t color)
+{
+    if (s_task == NULL || text == NULL) {
+        return;
+    }
+
+    portENTER_CRITICAL(&s_text_lock);
+    strncpy(s_pending_text, text, sizeof(s_pending_text) - 1);
+    s_pending_text[sizeof(s_pending_text) - 1] = '\0';
+    s_pending_color = color;
+    portEXIT_CRITICAL(&s_text_lock);
+
+    xTaskNotify(s_task, TICKER_EVT_TEXT, eSetBits);
+}
+
+void lcd_ticker_stop(void)
+{
+    if (s_task == NULL) {
+        return;
+    }
+
+    // 清空待显示文本，持锁等当前这一步画完，返回后字幕不会再动
+    portENTER_CRITICAL(&s_text_lock);
+    s_pending_text[0] = '\0';
+    portEXIT_CRITICAL(&s_text_lock);
+
+    xSemaphoreTake(s_draw_lock, portMAX_DELAY);
+    esp_timer_stop(s_timer);
+    s_active = false;
+    s_scrolling = false;
+    xSemaphoreGive(s_draw_lock);
+}
+
+void lcd_ticker_pause(bool paused)
+{
+    if (s_task == NULL) {
+        return;
+    }
+
+    // 持锁修改，返回时正在画的这一步已经画完
+    xSemaphoreTake(s_draw_lock, portMAX_DELAY);
+    s_paused = paused;
+    xSemaphoreGive(s_draw_lock);
+
+    // 区域可能已被覆盖：重新载入当前文本，整条重画（暂停期间设置的文本也在这时生效）
+    if (!paused) {
+        xTaskNotify(s_task, TICKER_EVT_TEXT, eSetBits);
+    }
+}
+
+void lcd_ticker_get_stats(lcd_ticker_stats_t *stats)
+{
+    if (stats == NULL) return;
+
+    portENTER_CRITICAL(&s_stats_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_stats_lock);
+}
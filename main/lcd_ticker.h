@@ -0,0 +1,36 @@
+#ifndef LCD_TICKER_H
+#define LCD_TICKER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "lcd_driver.h"
+
+// 滚动字幕高度（16点阵汉字/8x16 ASCII）
+#define LCD_TICKER_HEIGHT 16
+
+// 滚动字幕运行统计（每个统计周期更新一次）
+typedef struct {
+    float fps;               // 实际滚动帧率
+    uint32_t avg_bus_bytes;  // 平均每步SPI总线字节数
+    uint32_t avg_columns;    // 平均每步重发的列数
+    uint32_t avg_cpu_us;     // 平均每步CPU耗时（微秒）
+    float cpu_load;          // 滚动占用的CPU百分比
+} lcd_ticker_stats_t;
+
+// 初始化滚动字幕，显示在(x, y)开始、宽width、高16的区域
+esp_err_t lcd_ticker_init(lcd_display_t *lcd, uint16_t x, uint16_t y, uint16_t width);
+
+// 设置字幕文本（UTF-8汉字与ASCII混排），放得下时静态显示，放不下时循环滚动
+void lcd_ticker_set_text(const char *text, uint16_t color);
+
+// 停止字幕（同步：返回后不会再绘制，区域由调用者自己恢复背景）
+void lcd_ticker_stop(void);
+
+// 暂停/恢复字幕（同步：暂停返回后不会再绘制；恢复时整条重画，用于基准测试等独占屏幕的场合）
+void lcd_ticker_pause(bool paused);
+
+// 获取滚动统计
+void lcd_ticker_get_stats(lcd_ticker_stats_t *stats);
+
+#endif
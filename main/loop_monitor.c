@@ -0,0 +1,199 @@
+#include "loop_monitor.h"
+#include "trace.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include <string.h>
+
+static const uint32_t s_bucket_limits_us[LOOP_HIST_BUCKETS - 1] = {
+    1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000,
+    1000000, 1100000, 2000000,
+};
+
+static const char *const s_hist_names[LOOP_HIST_COUNT] = {
+    [LOOP_HIST_ITERATION] = "iteration",
+    [LOOP_HIST_RENDER]    = "render",
+};
+
+static const char *const s_subsys_names[LOOP_SUBSYS_COUNT] = {
+    [LOOP_SUBSYS_NONE]    = "unknown",
+    [LOOP_SUBSYS_WEATHER] = "weather",
+    [LOOP_SUBSYS_SPI]     = "spi",
+    [LOOP_SUBSYS_SNTP]    = "sntp",
+};
+
+// 每个子系统最近一次忙碌区间，用于给卡顿归因
+typedef struct {
+    bool active;
+    int64_t begin_us;
+    int64_t end_us;
+} busy_span_t;
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t s_hist[LOOP_HIST_COUNT][LOOP_HIST_BUCKETS];
+static uint32_t s_max_us[LOOP_HIST_COUNT];
+static busy_span_t s_busy[LOOP_SUBSYS_COUNT];
+static loop_stall_t s_stalls[LOOP_STALL_SLOTS];
+static int64_t s_last_iteration_us = 0;
+
+static int bucket_of(uint32_t us)
+{
+    int i = 0;
+    while (i < LOOP_HIST_BUCKETS - 1 && us >= s_bucket_limits_us[i]) {
+        i++;
+    }
+    return i;
+}
+
+// 找出在[start, end]内忙碌时间最长的子系统；重叠时间不到超时部分的一半时不归因
+static loop_subsys_t attribute(int64_t start, int64_t end, uint32_t excess_us)
+{
+    loop_subsys_t best = LOOP_SUBSYS_NONE;
+    int64_t best_overlap = 0;
+
+    for (int i = LOOP_SUBSYS_NONE + 1; i < LOOP_SUBSYS_COUNT; i++) {
+        const busy_span_t *span = &s_busy[i];
+        if (span->begin_us == 0) {
+            continue;
+        }
+        int64_t b = span->begin_us > start ? span->begin_us : start;
+        int64_t e = span->active ? end : (span->end_us < end ? span->end_us : end);
+        if (e - b > best_overlap) {
+            best_overlap = e - b;
+            best = (loop_subsys_t)i;
+        }
+    }
+    return best_overlap * 2 >= excess_us ? best : LOOP_SUBSYS_NONE;
+}
+
+// 在锁内调用：按时长保留最长的几条
+static void record_stall(loop_hist_t kind, uint32_t duration_us, loop_subsys_t subsys, int64_t now)
+{
+    int slot = 0;
+    for (int i = 1; i < LOOP_STALL_SLOTS; i++) {
+        if (s_stalls[i].duration_us < s_stalls[slot].duration_us) {
+            slot = i;
+        }
+    }
+    if (duration_us <= s_stalls[slot].duration_us) {
+        return;
+    }
+    s_stalls[slot] = (loop_stall_t) {
+        .duration_us = duration_us,
+        .uptime_s = (uint32_t)(now / 1000000),
+        .kind = kind,
+        .subsys = subsys,
+    };
+}
+
+static void record(loop_hist_t kind, uint32_t us, uint32_t stall_threshold_us, int64_t start, int64_t now)
+{
+    loop_subsys_t subsys = LOOP_SUBSYS_NONE;
+    bool stalled = us > stall_threshold_us;
+
+    portENTER_CRITICAL(&s_lock);
+    s_hist[kind][bucket_of(us)]++;
+    if (us > s_max_us[kind]) s_max_us[kind] = us;
+    if (stalled) {
+        subsys = attribute(start, now, us - (kind == LOOP_HIST_ITERATION ? 1000000 : 0));
+        record_stall(kind, us, subsys, now);
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (stalled) {
+        TRACE(TRACE_EV_STALL, (uint16_t)((kind << 8) | subsys), us, 0);
+    }
+}
+
+void loop_monitor_iteration(void)
+{
+    int64_t now = esp_timer_get_time();
+    int64_t last = s_last_iteration_us;
+    s_last_iteration_us = now;
+    if (last == 0) {
+        return;
+    }
+    record(LOOP_HIST_ITERATION, (uint32_t)(now - last), LOOP_STALL_ITERATION_US, last, now);
+}
+
+void loop_monitor_render(uint32_t elapsed_us)
+{
+    int64_t now = esp_timer_get_time();
+    record(LOOP_HIST_RENDER, elapsed_us, LOOP_STALL_RENDER_US, now - elapsed_us, now);
+}
+
+void loop_monitor_busy(loop_subsys_t subsys, bool busy)
+{
+    if (subsys <= LOOP_SUBSYS_NONE || subsys >= LOOP_SUBSYS_COUNT) {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_lock);
+    busy_span_t *span = &s_busy[subsys];
+    if (busy) {
+        span->active = true;
+        span->begin_us = now;
+    } else {
+        span->active = false;
+        span->end_us = now;
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+const char *loop_monitor_subsys_name(loop_subsys_t subsys)
+{
+    return subsys < LOOP_SUBSYS_COUNT ? s_subsys_names[subsys] : "?";
+}
+
+const char *loop_monitor_hist_name(loop_hist_t kind)
+{
+    return kind < LOOP_HIST_COUNT ? s_hist_names[kind] : "?";
+}
+
+void loop_monitor_dump(FILE *stream)
+{
+    uint32_t hist[LOOP_HIST_COUNT][LOOP_HIST_BUCKETS];
+    uint32_t max_us[LOOP_HIST_COUNT];
+    loop_stall_t stalls[LOOP_STALL_SLOTS];
+
+    // 先拷贝出来再打印，不在临界区里做输出
+    portENTER_CRITICAL(&s_lock);
+    memcpy(hist, s_hist, sizeof(hist));
+    memcpy(max_us, s_max_us, sizeof(max_us));
+    memcpy(stalls, s_stalls, sizeof(stalls));
+    portEXIT_CRITICAL(&s_lock);
+
+    // 卡顿按时长从长到短输出
+    for (int i = 1; i < LOOP_STALL_SLOTS; i++) {
+        loop_stall_t cur = stalls[i];
+        int j = i - 1;
+        while (j >= 0 && stalls[j].duration_us < cur.duration_us) {
+            stalls[j + 1] = stalls[j];
+            j--;
+        }
+        stalls[j + 1] = cur;
+    }
+
+    for (int h = 0; h < LOOP_HIST_COUNT; h++) {
+        fprintf(stream, "%s (max %lu us):\n", s_hist_names[h], max_us[h]);
+        for (int i = 0; i < LOOP_HIST_BUCKETS; i++) {
+            if (hist[h][i] == 0) {
+                continue;
+            }
+            if (i < LOOP_HIST_BUCKETS - 1) {
+                fprintf(stream, "  < %7lu us: %lu\n", s_bucket_limits_us[i], hist[h][i]);
+            } else {
+                fprintf(stream, "  >=%7lu us: %lu\n", s_bucket_limits_us[i - 1], hist[h][i]);
+            }
+        }
+    }
+
+    fprintf(stream, "longest stalls:\n");
+    for (int i = 0; i < LOOP_STALL_SLOTS; i++) {
+        if (stalls[i].duration_us == 0) {
+            continue;
+        }
+        fprintf(stream, "  %-9s %8lu us at %lus, %s\n", s_hist_names[stalls[i].kind],
+                stalls[i].duration_us, stalls[i].uptime_s, s_subsys_names[stalls[i].subsys]);
+    }
+}
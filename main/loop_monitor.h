@@ -0,0 +1,60 @@
+#ifndef LOOP_MONITOR_H
+#define LOOP_MONITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+// 主循环健康监测：循环周期和渲染耗时的固定桶直方图，以及最长的几次卡顿（带子系统标记）
+
+// 可能造成卡顿的子系统
+typedef enum {
+    LOOP_SUBSYS_NONE = 0,   // 无法归因
+    LOOP_SUBSYS_WEATHER,    // 天气请求
+    LOOP_SUBSYS_SPI,        // 屏幕绘制（SPI传输、等待SPI锁）
+    LOOP_SUBSYS_SNTP,       // 时间同步
+    LOOP_SUBSYS_COUNT,
+} loop_subsys_t;
+
+// 直方图
+typedef enum {
+    LOOP_HIST_ITERATION = 0, // 相邻两次循环唤醒的间隔
+    LOOP_HIST_RENDER,        // 单次渲染耗时
+    LOOP_HIST_COUNT,
+} loop_hist_t;
+
+// 桶上界（微秒）：<1ms, <2ms, <5ms, ... <2s, 最后一个桶放>=2s
+#define LOOP_HIST_BUCKETS 13
+
+// 循环间隔超过这个值记为卡顿（正常为1秒）
+#define LOOP_STALL_ITERATION_US (1500 * 1000)
+// 单次渲染超过这个值记为卡顿
+#define LOOP_STALL_RENDER_US    (100 * 1000)
+
+// 保留的最长卡顿条数
+#define LOOP_STALL_SLOTS 8
+
+typedef struct {
+    uint32_t duration_us;   // 卡顿时长（循环间隔或渲染耗时）
+    uint32_t uptime_s;      // 发生时的运行时间
+    loop_hist_t kind;
+    loop_subsys_t subsys;
+} loop_stall_t;
+
+// 渲染任务每次被唤醒时调用
+void loop_monitor_iteration(void);
+
+// 渲染任务每次渲染完成后调用
+void loop_monitor_render(uint32_t elapsed_us);
+
+// 子系统开始/结束可能长时间阻塞的工作（任意任务）
+void loop_monitor_busy(loop_subsys_t subsys, bool busy);
+
+// 子系统/直方图名称（解码跟踪记录时用）
+const char *loop_monitor_subsys_name(loop_subsys_t subsys);
+const char *loop_monitor_hist_name(loop_hist_t kind);
+
+// 输出直方图和最长卡顿
+void loop_monitor_dump(FILE *stream);
+
+#endif
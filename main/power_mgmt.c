@@ -0,0 +1,163 @@
+#include "power_mgmt.h"
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "driver/uart.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+
+static const char *TAG = "POWER";
+
+// 空闲时的最低频率（晶振频率），渲染和联网时升到默认CPU频率
+#define POWER_MIN_FREQ_MHZ 40
+
+// 串口唤醒阈值：RX线上出现这么多个上升沿时唤醒（硬件最小值3）
+#define POWER_UART_WAKEUP_THRESHOLD 3
+
+static const char *const s_lock_names[POWER_LOCK_COUNT] = {
+    [POWER_LOCK_RENDER]  = "render",
+    [POWER_LOCK_NET]     = "net",
+    [POWER_LOCK_CONSOLE] = "console",
+};
+
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t s_locks[POWER_LOCK_COUNT];
+
+// 绘制和联网要最高频率；控制台只需要保持唤醒，频率可以低
+static const esp_pm_lock_type_t s_lock_types[POWER_LOCK_COUNT] = {
+    [POWER_LOCK_RENDER]  = ESP_PM_CPU_FREQ_MAX,
+    [POWER_LOCK_NET]     = ESP_PM_CPU_FREQ_MAX,
+    [POWER_LOCK_CONSOLE] = ESP_PM_NO_LIGHT_SLEEP,
+};
+#endif
+static bool s_initialized = false;
+
+// 嵌套计数和统计（多个任务、两个核心都会调用）
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static int s_depth[POWER_LOCK_COUNT];
+static int64_t s_since_us[POWER_LOCK_COUNT];
+static power_mgmt_stats_t s_stats;
+static int64_t s_start_us = 0;
+
+esp_err_t power_mgmt_init(void)
+{
+    if (s_initialized) {
+        return ESP_OK;
+    }
+
+#if CONFIG_PM_ENABLE
+    for (int i = 0; i < POWER_LOCK_COUNT; i++) {
+        esp_err_t ret = esp_pm_lock_create(s_lock_types[i], 0, s_lock_names[i], &s_locks[i]);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to create %s lock: %s", s_lock_names[i], esp_err_to_name(ret));
+            return ret;
+        }
+    }
+
+    esp_pm_config_t config = {
+        .max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+        .min_freq_mhz = POWER_MIN_FREQ_MHZ,
+        .light_sleep_enable = true,
+    };
+    esp_err_t ret = esp_pm_configure(&config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to configure power management: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ESP_LOGI(TAG, "Power management enabled: %d-%d MHz, automatic light sleep",
+             POWER_MIN_FREQ_MHZ, CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+#else
+    ESP_LOGW(TAG, "CONFIG_PM_ENABLE is off, running at fixed frequency");
+#endif
+
+    s_start_us = esp_timer_get_time();
+    s_initialized = true;
+    return ESP_OK;
+}
+
+esp_err_t power_mgmt_enable_uart_wakeup(int uart_num)
+{
+#if CONFIG_PM_ENABLE
+    esp_err_t ret = uart_set_wakeup_threshold(uart_num, POWER_UART_WAKEUP_THRESHOLD);
+    if (ret == ESP_OK) {
+        ret = esp_sleep_enable_uart_wakeup(uart_num);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to enable UART%d wakeup: %s", uart_num, esp_err_to_name(ret));
+        return ret;
+    }
+    ESP_LOGI(TAG, "UART%d input wakes from light sleep", uart_num);
+#endif
+    return ESP_OK;
+}
+
+void power_mgmt_acquire(power_lock_t lock)
+{
+    if (!s_initialized || lock >= POWER_LOCK_COUNT) {
+        return;
+    }
+
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_acquire(s_locks[lock]);
+#endif
+
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_lock);
+    if (s_depth[lock]++ == 0) {
+        s_since_us[lock] = now;
+        s_stats.bursts[lock]++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void power_mgmt_release(power_lock_t lock)
+{
+    if (!s_initialized || lock >= POWER_LOCK_COUNT) {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_lock);
+    if (s_depth[lock] > 0 && --s_depth[lock] == 0) {
+        s_stats.held_us[lock] += now - s_since_us[lock];
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_release(s_locks[lock]);
+#endif
+}
+
+void power_mgmt_get_stats(power_mgmt_stats_t *stats)
+{
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_lock);
+    *stats = s_stats;
+    // 正在持有的锁把到现在为止的时间也算上
+    for (int i = 0; i < POWER_LOCK_COUNT; i++) {
+        if (s_depth[i] > 0) {
+            stats->held_us[i] += now - s_since_us[i];
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+    stats->uptime_us = s_initialized ? now - s_start_us : 0;
+}
+
+void power_mgmt_dump(FILE *stream)
+{
+    power_mgmt_stats_t stats;
+    power_mgmt_get_stats(&stats);
+
+    fprintf(stream, "uptime %llu ms\n", stats.uptime_us / 1000);
+    for (int i = 0; i < POWER_LOCK_COUNT; i++) {
+        uint32_t permille = stats.uptime_us ? (uint32_t)(stats.held_us[i] * 1000 / stats.uptime_us) : 0;
+        fprintf(stream, "  %-6s %6lu bursts, held %llu ms (%lu.%lu%%)\n", s_lock_names[i],
+                stats.bursts[i], stats.held_us[i] / 1000, permille / 10, permille % 10);
+    }
+
+#if CONFIG_PM_ENABLE
+    // 各电源状态（light sleep、最低/最高频率）的时间由esp_pm统计
+    esp_pm_dump_locks(stream);
+#endif
+}
@@ -0,0 +1,41 @@
+#ifndef POWER_MGMT_H
+#define POWER_MGMT_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "esp_err.h"
+
+// 电源管理：空闲时自动进入light sleep，由整秒调度定时器（或控制台串口输入）唤醒；
+// 只在渲染和联网期间持有CPU最高频率锁，其余时间降到最低频率
+
+// 频率锁的持有者
+typedef enum {
+    POWER_LOCK_RENDER = 0,  // 时钟控件、动画、字幕的绘制突发
+    POWER_LOCK_NET,         // 天气请求
+    POWER_LOCK_CONSOLE,     // 控制台有人输入：不进light sleep（睡眠期间串口收不到字符）
+    POWER_LOCK_COUNT,
+} power_lock_t;
+
+// 统计
+typedef struct {
+    uint64_t uptime_us;                    // 启用电源管理以来的时间
+    uint32_t bursts[POWER_LOCK_COUNT];     // 各锁的持有次数
+    uint64_t held_us[POWER_LOCK_COUNT];    // 各锁的累计持有时间
+} power_mgmt_stats_t;
+
+// 配置动态调频和自动light sleep（sdkconfig未启用CONFIG_PM_ENABLE时只记录统计）
+esp_err_t power_mgmt_init(void);
+
+// 允许控制台串口输入把芯片从light sleep唤醒（用于唤醒的前几个字符会丢失）
+esp_err_t power_mgmt_enable_uart_wakeup(int uart_num);
+
+// 获取/释放锁，可以在多个任务中嵌套调用
+void power_mgmt_acquire(power_lock_t lock);
+void power_mgmt_release(power_lock_t lock);
+
+void power_mgmt_get_stats(power_mgmt_stats_t *stats);
+
+// 输出各电源状态的时间（需要CONFIG_PM_PROFILING）和各锁的占用情况
+void power_mgmt_dump(FILE *stream);
+
+#endif
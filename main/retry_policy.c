@@ -0,0 +1,79 @@
+#include "retry_policy.h"
+#include "esp_random.h"
+#include <string.h>
+
+void retry_policy_init(retry_policy_t *p, const retry_policy_config_t *cfg)
+{
+    memset(p, 0, sizeof(*p));
+    p->cfg = *cfg;
+    p->state = RETRY_CLOSED;
+}
+
+void retry_policy_attempt(retry_policy_t *p)
+{
+    if (p->state == RETRY_OPEN) {
+        p->state = RETRY_HALF_OPEN;
+        p->probes++;
+    }
+}
+
+void retry_policy_success(retry_policy_t *p)
+{
+    p->state = RETRY_CLOSED;
+    p->consecutive_failures = 0;
+    p->first_failure_us = 0;
+    p->next_delay_ms = 0;
+}
+
+// 在delay上加±jitter_pct%的随机量，避免多台设备在同一时刻一起重试
+static uint32_t apply_jitter(uint32_t delay, uint8_t jitter_pct)
+{
+    if (jitter_pct == 0 || delay == 0) {
+        return delay;
+    }
+    uint32_t span = (uint32_t)((uint64_t)delay * jitter_pct / 100);
+    uint32_t offset = esp_random() % (2 * span + 1);
+    return delay - span + offset;
+}
+
+uint32_t retry_policy_failure(retry_policy_t *p, int64_t now_us)
+{
+    p->total_failures++;
+    p->consecutive_failures++;
+    if (p->first_failure_us == 0) {
+        p->first_failure_us = now_us;
+    }
+
+    bool window_expired = now_us - p->first_failure_us >= (int64_t)p->cfg.window_ms * 1000;
+    if (p->state == RETRY_HALF_OPEN) {
+        // 探测失败：保持断路，等下一个探测间隔
+        p->state = RETRY_OPEN;
+    } else if (p->state == RETRY_CLOSED &&
+               (p->consecutive_failures >= p->cfg.open_after || window_expired)) {
+        p->state = RETRY_OPEN;
+        p->opens++;
+    }
+
+    uint32_t delay;
+    if (p->state == RETRY_OPEN) {
+        delay = p->cfg.probe_ms;
+    } else {
+        // base * 2^(n-1)，移位前先限制次数避免溢出
+        uint32_t shift = p->consecutive_failures - 1;
+        if (shift > 16) shift = 16;
+        uint64_t backoff = (uint64_t)p->cfg.base_ms << shift;
+        delay = backoff > p->cfg.max_ms ? p->cfg.max_ms : (uint32_t)backoff;
+    }
+    p->next_delay_ms = apply_jitter(delay, p->cfg.jitter_pct);
+    return p->next_delay_ms;
+}
+
+const char *retry_policy_state_name(retry_state_t state)
+{
+    switch (state) {
+        case RETRY_CLOSED:    return "closed";
+        case RETRY_OPEN:      return "open";
+        case RETRY_HALF_OPEN: return "half-open";
+        default:              return "?";
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef RETRY_POLICY_H
+#define RETRY_POLICY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// 失败重试策略：指数退避加随机抖动，连续失败过多或失败持续太久时断路，
+// 断路后只按固定间隔发一次探测请求，探测成功才恢复正常
+
+typedef enum {
+    RETRY_CLOSED = 0,   // 正常
+    RETRY_OPEN,         // 断路，等待探测
+    RETRY_HALF_OPEN,    // 正在探测
+} retry_state_t;
+
+typedef struct {
+    uint32_t base_ms;       // 第一次失败后的等待时间，之后每次翻倍
+    uint32_t max_ms;        // 退避上限
+    uint8_t jitter_pct;     // 等待时间随机浮动的百分比（±）
+    uint8_t open_after;     // 连续失败这么多次后断路
+    uint32_t window_ms;     // 从第一次失败起超过这么久仍未恢复也断路
+    uint32_t probe_ms;      // 断路后的探测间隔
+} retry_policy_config_t;
+
+typedef struct {
+    retry_policy_config_t cfg;
+    retry_state_t state;
+    uint32_t consecutive_failures;
+    int64_t first_failure_us;   // 本轮连续失败开始的时间（esp_timer），0表示没有失败
+    uint32_t next_delay_ms;     // 最近一次算出的等待时间
+    uint32_t total_failures;
+    uint32_t opens;             // 断路次数
+    uint32_t probes;            // 探测次数
+} retry_policy_t;
+
+void retry_policy_init(retry_policy_t *p, const retry_policy_config_t *cfg);
+
+// 开始一次请求前调用：断路状态下这次请求就是探测
+void retry_policy_attempt(retry_policy_t *p);
+
+// 请求成功：清除失败计数并关闭断路
+void retry_policy_success(retry_policy_t *p);
+
+// 请求失败：更新状态，返回到下一次尝试前应等待的毫秒数
+uint32_t retry_policy_failure(retry_policy_t *p, int64_t now_us);
+
+const char *retry_policy_state_name(retry_state_t state);
+
+#endif
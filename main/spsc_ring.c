@@ -0,0 +1,34 @@
+#include "spsc_ring.h"
+#include <string.h>
+
+bool spsc_ring_push(spsc_ring_t *ring, const void *item)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    if (head - tail >= ring->capacity) {
+        return false;
+    }
+
+    memcpy(ring->slots + (head & (ring->capacity - 1)) * ring->slot_size, item, ring->slot_size);
+
+    // release：消费者看到新的head时，槽位数据一定已经写完
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
+
+bool spsc_ring_pop(spsc_ring_t *ring, void *item)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    if (head == tail) {
+        return false;
+    }
+
+    memcpy(item, ring->slots + (tail & (ring->capacity - 1)) * ring->slot_size, ring->slot_size);
+
+    // release：生产者看到新的tail时，槽位已经读完，可以覆盖
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return true;
+}
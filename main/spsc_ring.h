@@ -0,0 +1,34 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+// 单生产者/单消费者无锁环形队列：生产者和消费者可以在不同核心上，不需要加锁
+// 每个槽位保存一份完整的数据副本，入队后不再修改
+typedef struct {
+    uint8_t *slots;          // 槽位存储区（capacity * slot_size字节）
+    size_t slot_size;        // 每个槽位字节数
+    uint32_t capacity;       // 槽位数，必须是2的幂
+    atomic_uint head;        // 下一个写入位置（只有生产者修改）
+    atomic_uint tail;        // 下一个读取位置（只有消费者修改）
+} spsc_ring_t;
+
+// 定义一个静态环形队列：SPSC_RING_DEFINE(name, type, capacity)
+#define SPSC_RING_DEFINE(name, type, cap)                      \
+    static type name##_slots[cap];                             \
+    static spsc_ring_t name = {                                \
+        .slots = (uint8_t *)name##_slots,                      \
+        .slot_size = sizeof(type),                             \
+        .capacity = (cap),                                     \
+    }
+
+// 入队（只能在生产者中调用），队列满时返回false
+bool spsc_ring_push(spsc_ring_t *ring, const void *item);
+
+// 出队（只能在消费者中调用），队列空时返回false
+bool spsc_ring_pop(spsc_ring_t *ring, void *item);
+
+#endif
@@ -0,0 +1,113 @@
+#include "time_state.h"
+#include <stdatomic.h>
+
+static atomic_uint s_adjust_gen = 0;
+
+static void format_2d(char *out, int v)
+{
+    out[0] = '0' + v / 10;
+    out[1] = '0' + v % 10;
+    out[2] = '\0';
+}
+
+static void format_date(time_state_t *ts)
+{
+    format_2d(ts->date, ts->month);
+    ts->date[2] = '/';
+    format_2d(ts->date + 3, ts->day);
+}
+
+static int days_in_month(int year, int month)
+{
+    static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month == 2 && ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)) {
+        return 29;
+    }
+    return days[month - 1];
+}
+
+void time_state_sync(time_state_t *ts, time_t now)
+{
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+
+    ts->epoch = now;
+    ts->year = timeinfo.tm_year + 1900;
+    ts->month = timeinfo.tm_mon + 1;
+    ts->day = timeinfo.tm_mday;
+    ts->hour = timeinfo.tm_hour;
+    ts->minute = timeinfo.tm_min;
+    ts->second = timeinfo.tm_sec;
+    ts->wday = timeinfo.tm_wday;
+
+    format_2d(ts->hh, ts->hour);
+    format_2d(ts->mm, ts->minute);
+    ts->ss[0] = ':';
+    format_2d(ts->ss + 1, ts->second);
+    format_date(ts);
+
+    ts->adjust_gen = atomic_load_explicit(&s_adjust_gen, memory_order_acquire);
+    ts->resyncs++;
+}
+
+uint32_t time_state_advance(time_state_t *ts, time_t now)
+{
+    uint32_t gen = atomic_load_explicit(&s_adjust_gen, memory_order_acquire);
+    // year为0表示还没有完整转换过
+    if (gen == ts->adjust_gen && ts->year != 0) {
+        if (now == ts->epoch) {
+            return 0;
+        }
+        if (now != ts->epoch + 1) {
+            // 跳秒（渲染被长时间阻塞等）或时间倒退，完整转换
+            time_state_sync(ts, now);
+            return TIME_FIELD_ALL;
+        }
+    } else {
+        time_state_sync(ts, now);
+        return TIME_FIELD_ALL;
+    }
+
+    // 正好前进一秒：逐级进位（时区为固定偏移，没有夏令时）
+    uint32_t changed = TIME_FIELD_SECOND;
+    ts->epoch = now;
+    ts->steps++;
+
+    if (++ts->second == 60) {
+        ts->second = 0;
+        changed |= TIME_FIELD_MINUTE;
+        if (++ts->minute == 60) {
+            ts->minute = 0;
+            changed |= TIME_FIELD_HOUR;
+            if (++ts->hour == 24) {
+                ts->hour = 0;
+                changed |= TIME_FIELD_DAY;
+                ts->wday = (ts->wday + 1) % 7;
+                if (++ts->day > days_in_month(ts->year, ts->month)) {
+                    ts->day = 1;
+                    if (++ts->month > 12) {
+                        ts->month = 1;
+                        ts->year++;
+                    }
+                }
+                format_date(ts);
+            }
+            format_2d(ts->hh, ts->hour);
+        }
+        format_2d(ts->mm, ts->minute);
+    }
+    format_2d(ts->ss + 1, ts->second);
+
+    return changed;
+}
+
+void time_state_mark_adjusted(void)
+{
+    atomic_fetch_add_explicit(&s_adjust_gen, 1, memory_order_release);
+}
+
+void time_state_get_stats(const time_state_t *ts, time_state_stats_t *stats)
+{
+    stats->steps = ts->steps;
+    stats->resyncs = ts->resyncs;
+}
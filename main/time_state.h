@@ -0,0 +1,50 @@
+#ifndef TIME_STATE_H
+#define TIME_STATE_H
+
+#include <stdint.h>
+#include <time.h>
+
+// 增量维护的本地时间：只在首次和校时后调用一次localtime_r，之后每秒按进位规则推进，
+// 并且只重新格式化发生变化的字段
+
+// 变化字段标志（time_state_advance的返回值）
+#define TIME_FIELD_SECOND (1 << 0)
+#define TIME_FIELD_MINUTE (1 << 1)
+#define TIME_FIELD_HOUR   (1 << 2)
+#define TIME_FIELD_DAY    (1 << 3)  // 日期、星期（含跨月、跨年）
+#define TIME_FIELD_ALL    (TIME_FIELD_SECOND | TIME_FIELD_MINUTE | TIME_FIELD_HOUR | TIME_FIELD_DAY)
+
+typedef struct {
+    time_t epoch;               // 当前状态对应的UTC秒数
+    int year, month, day;       // month为1-12
+    int hour, minute, second;
+    int wday;                   // 0为周日
+    char hh[3];                 // "HH"
+    char mm[3];                 // "MM"
+    char ss[4];                 // ":SS"
+    char date[6];               // "MM/DD"
+    uint32_t adjust_gen;        // 已处理的校时代数
+    uint32_t steps;             // 本实例的增量推进次数
+    uint32_t resyncs;           // 本实例的完整转换次数
+} time_state_t;
+
+// 统计（每个time_state单独计数，时钟调度器和渲染各有一份，不会重复计入）
+typedef struct {
+    uint32_t steps;             // 增量推进次数
+    uint32_t resyncs;           // 完整转换次数（首次、校时、跳秒）
+} time_state_stats_t;
+
+// 用localtime_r完整转换一次
+void time_state_sync(time_state_t *ts, time_t now);
+
+// 推进到now：正好多一秒时增量进位，没变时什么都不做，其余情况（校时、漏掉多秒）完整转换；
+// 返回发生变化的字段
+uint32_t time_state_advance(time_state_t *ts, time_t now);
+
+// 系统时间被设置后调用（任意任务），所有time_state在下一次推进时完整转换
+void time_state_mark_adjusted(void);
+
+// 读取ts的统计（在推进ts的任务中调用）
+void time_state_get_stats(const time_state_t *ts, time_state_stats_t *stats);
+
+#endif
@@ -0,0 +1,91 @@
+#include "trace.h"
+#include "loop_monitor.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include <stdio.h>
+
+// 记录数（2的幂），16字节一条，共4KB
+#define TRACE_RING_SIZE 256
+
+// 多个任务、两个核心都可能写：占位和填写在同一个临界区内完成，记录不会被交错写坏
+// （只有几条存储指令，持锁时间很短）；导出时也在锁内逐条拷贝
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static trace_record_t s_records[TRACE_RING_SIZE];
+static unsigned s_next = 0;
+
+// 事件名（参数的解码方式见print_record）
+static const char *const s_event_names[TRACE_EV_COUNT] = {
+    [TRACE_EV_BG_RESTORE]    = "bg_restore",
+    [TRACE_EV_IMAGE_DRAW]    = "image_draw",
+    [TRACE_EV_WIDGET_RENDER] = "widget",
+    [TRACE_EV_FRAME]         = "frame",
+    [TRACE_EV_TICK_DRAWN]    = "tick_drawn",
+    [TRACE_EV_WEATHER]       = "weather",
+    [TRACE_EV_STALL]         = "stall",
+};
+
+void trace_write(trace_event_t id, uint16_t a, uint32_t b, uint32_t c)
+{
+    portENTER_CRITICAL(&s_lock);
+    trace_record_t *r = &s_records[s_next++ & (TRACE_RING_SIZE - 1)];
+    // 在锁内取时间，环形缓冲区中的记录按时间先后排列
+    r->ts_us = (uint32_t)esp_timer_get_time();
+    r->id = id;
+    r->a = a;
+    r->b = b;
+    r->c = c;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+static void print_record(const trace_record_t *r)
+{
+    const char *name = r->id < TRACE_EV_COUNT ? s_event_names[r->id] : "?";
+    printf("%10lu %-10s ", r->ts_us, name);
+
+    switch (r->id) {
+        case TRACE_EV_BG_RESTORE:
+        case TRACE_EV_IMAGE_DRAW:
+            printf("(%lu,%lu) %lux%lu %u us\n",
+                   r->b >> 16, r->b & 0xFFFF, r->c >> 16, r->c & 0xFFFF, r->a);
+            break;
+        case TRACE_EV_WIDGET_RENDER:
+            // b保存的是控件名字符串常量的地址
+            printf("%s fp=%08lx %u us\n", r->b ? (const char *)(uintptr_t)r->b : "?", r->c, r->a);
+            break;
+        case TRACE_EV_FRAME:
+            printf("rendered=%u deferred=%lu %lu us\n", r->a, r->b, r->c);
+            break;
+        case TRACE_EV_TICK_DRAWN:
+            printf("latency=%lu us%s\n", r->b, r->a ? " (net busy)" : "");
+            break;
+        case TRACE_EV_WEATHER:
+            printf("v%lu code=%ld\n", r->b, (long)(int32_t)r->c);
+            break;
+        case TRACE_EV_STALL:
+            printf("%s %lu us (%s)\n", loop_monitor_hist_name((loop_hist_t)(r->a >> 8)), r->b,
+                   loop_monitor_subsys_name((loop_subsys_t)(r->a & 0xFF)));
+            break;
+        default:
+            printf("a=%u b=%lu c=%lu\n", r->a, r->b, r->c);
+            break;
+    }
+}
+
+void trace_dump(int count)
+{
+    portENTER_CRITICAL(&s_lock);
+    unsigned end = s_next;
+    portEXIT_CRITICAL(&s_lock);
+    if (count <= 0 || count > TRACE_RING_SIZE) count = TRACE_RING_SIZE;
+    if ((unsigned)count > end) count = end;
+
+    // 打印期间新写入的记录可能覆盖最老的几条，调试用足够
+    printf("---- trace: last %d of %u events ----\n", count, end);
+    for (unsigned i = end - count; i != end; i++) {
+        trace_record_t r;
+        portENTER_CRITICAL(&s_lock);
+        r = s_records[i & (TRACE_RING_SIZE - 1)];
+        portEXIT_CRITICAL(&s_lock);
+        print_record(&r);
+    }
+}
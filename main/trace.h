@@ -0,0 +1,46 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+// 二进制事件跟踪：热路径只写一条定长记录（不格式化、不阻塞串口），需要时再解码输出
+#define TRACE_ENABLED 1
+
+// 事件类型（解码格式见trace.c中的s_event_formats，两边顺序一致）
+typedef enum {
+    TRACE_EV_BG_RESTORE = 0,   // a=耗时us，b=坐标，c=尺寸
+    TRACE_EV_IMAGE_DRAW,       // a=耗时us，b=坐标，c=尺寸
+    TRACE_EV_WIDGET_RENDER,    // a=耗时us，b=控件名，c=值指纹
+    TRACE_EV_FRAME,            // a=重绘控件数，b=顺延控件数，c=帧耗时us
+    TRACE_EV_TICK_DRAWN,       // a=网络繁忙，b=tick-to-pixel延迟us
+    TRACE_EV_WEATHER,          // b=快照版本，c=天气代码
+    TRACE_EV_STALL,            // a=直方图<<8|子系统，b=卡顿时长us
+    TRACE_EV_COUNT,
+} trace_event_t;
+
+// 一条记录16字节
+typedef struct {
+    uint32_t ts_us;   // esp_timer时间戳（低32位）
+    uint16_t id;
+    uint16_t a;
+    uint32_t b;
+    uint32_t c;
+} trace_record_t;
+
+// 坐标/尺寸打包成一个32位参数
+#define TRACE_PACK(hi, lo) ((((uint32_t)(hi) & 0xFFFF) << 16) | ((uint32_t)(lo) & 0xFFFF))
+// 耗时等参数截断到16位
+#define TRACE_U16(v) ((uint16_t)((v) > 0xFFFF ? 0xFFFF : (v)))
+
+void trace_write(trace_event_t id, uint16_t a, uint32_t b, uint32_t c);
+
+// 解码并打印最近count条记录
+void trace_dump(int count);
+
+#if TRACE_ENABLED
+#define TRACE(id, a, b, c) trace_write((id), (a), (b), (c))
+#else
+#define TRACE(id, a, b, c) do { } while (0)
+#endif
+
+#endif
@@ -1,201 +1,576 @@
 #include "weather.h"
 #include "esp_http_client.h"
 #include "esp_log.h"
-#include "cJSON.h"
+#include "esp_timer.h"
+#include "dns_cache.h"
+#include "sdkconfig.h"
+#include "esp_crt_bundle.h"
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 
 static const char *TAG = "WEATHER";
 
-// 心知天气API配置
-#define WEATHER_API_KEY "SrqxKpth7Fvzao2Wi"
-#define WEATHER_LOCATION "hangzhou"
-#define WEATHER_LANGUAGE "zh-Hans"
-#define WEATHER_UNIT "c"
+// 收发缓冲区和响应大小上限见main/Kconfig.projbuild；没有经过menuconfig时用默认值
+#ifndef CONFIG_WEATHER_HTTP_RX_BUFFER_SIZE
+#define CONFIG_WEATHER_HTTP_RX_BUFFER_SIZE 512
+#endif
+#ifndef CONFIG_WEATHER_HTTP_TX_BUFFER_SIZE
+#define CONFIG_WEATHER_HTTP_TX_BUFFER_SIZE 512
+#endif
+#ifndef CONFIG_WEATHER_MAX_RESPONSE_SIZE
+#define CONFIG_WEATHER_MAX_RESPONSE_SIZE 8192
+#endif
 
-// 用于存储HTTP响应数据的结构
+// 服务器地址默认由数据源给出；编译时定义WEATHER_API_BASE可以指向本地的替身服务器
+// （见host/weather_stub_server.py），数据格式仍按所选数据源解析
+
+#if CONFIG_WEATHER_TLS_CUSTOM_CA
+// 测试用的替身服务器证书（host/certs/stub_cert.pem，由CMake嵌入）
+extern const char stub_cert_pem_start[] asm("_binary_stub_cert_pem_start");
+#endif
+
+// 当前数据源，只在天气任务中切换
+#if CONFIG_WEATHER_PROVIDER_MOCK
+static const weather_provider_t *s_provider = &weather_provider_mock;
+#else
+static const weather_provider_t *s_provider = &weather_provider_seniverse;
+#endif
+
+// 为true时不带条件头、不按last_update去重，每次都当作新数据（基准测试用）
+static volatile bool s_force_refresh = false;
+
+// 长连接客户端：句柄和TCP连接在多次请求之间复用，只在出错后重建
+// 实况和预报是同一台服务器上的两个接口，每次刷新在同一个连接上连续请求
+static esp_http_client_handle_t s_client = NULL;
+
+// 每个接口的URL和条件请求的校验值：上次成功响应的ETag/Last-Modified和数据中的last_update
 typedef struct {
-    char *buffer;
-    size_t size;
-    size_t length;
-} http_response_t;
+    const char *name;
+    char url[256];
+    char etag[64];
+    char last_modified[40];
+    char last_update[32];
+} weather_endpoint_t;
+
+static weather_endpoint_t s_endpoints[WEATHER_REQ_COUNT] = {
+    [WEATHER_REQ_NOW] = { .name = "now" },
+    [WEATHER_REQ_DAILY] = { .name = "daily" },
+};
+
+// 从数据源的服务器地址（或WEATHER_API_BASE）解析出的服务器；URL里直接用DNS缓存给出的地址，Host头用原主机名。
+// 每个数据源在weather_init中解析一次，之后只读：其他任务（联网后预解析DNS等）随时可以读主机名，
+// TLS握手时SNI指向的缓冲区也不会被改写；切换数据源只切换s_server指针
+typedef struct {
+    const weather_provider_t *provider;
+    char scheme[8];
+    char host[48];
+    int port;
+    char host_header[56];
+} weather_server_t;
+
+static const weather_provider_t *const s_providers[] = {
+    &weather_provider_seniverse,
+    &weather_provider_mock,
+};
+#define WEATHER_PROVIDER_COUNT (sizeof(s_providers) / sizeof(s_providers[0]))
+
+static weather_server_t s_servers[WEATHER_PROVIDER_COUNT];
+static const weather_server_t *volatile s_server = NULL; // 当前数据源的服务器，weather_init之前为NULL
+static char s_api_addr[16];     // 当前URL里的IPv4地址，变化时重建URL
 
-// 全局响应数据
-static http_response_t response_data = {0};
+// 句柄上当前设置的请求头。set_header每次都会复制一份字符串（堆分配），只在值变化时才调用；
+// set_url换主机时会把Host头改成URL里的IP，所以地址变化后要重新设置
+static bool s_host_header_set = false;
+static char s_sent_etag[64];
+static char s_sent_last_modified[40];
 
+// 本次请求中建立新连接的时刻（esp_timer时间），0表示复用了已有连接
+static int64_t s_connected_us = 0;
+
+// 本次响应头里收到的校验值，响应成功解析后才替换接口的当前值
+static char s_pending_etag[64];
+static char s_pending_last_modified[40];
+
+// 本次响应体已收到的字节数，超过CONFIG_WEATHER_MAX_RESPONSE_SIZE算超长
+static size_t s_body_bytes = 0;
+static bool s_overflow = false;
+
+static weather_client_stats_t s_stats = {0};
+static uint64_t s_total_connect_us = 0;
+static uint64_t s_total_request_us = 0;
+
+// HTTP数据块直接喂给数据源的增量解析器，不缓存整个响应
 esp_err_t _http_event_handler(esp_http_client_event_t *evt)
 {
+    weather_parse_state_t *state = (weather_parse_state_t *)evt->user_data;
+
     switch(evt->event_id) {
+        case HTTP_EVENT_ON_CONNECTED:
+            s_connected_us = esp_timer_get_time();
+            break;
+
+        case HTTP_EVENT_ON_HEADER:
+            if (strcasecmp(evt->header_key, "ETag") == 0) {
+                snprintf(s_pending_etag, sizeof(s_pending_etag), "%s", evt->header_value);
+            } else if (strcasecmp(evt->header_key, "Last-Modified") == 0) {
+                snprintf(s_pending_last_modified, sizeof(s_pending_last_modified), "%s", evt->header_value);
+            }
+            break;
+
         case HTTP_EVENT_ON_DATA:
             ESP_LOGD(TAG, "HTTP_EVENT_ON_DATA, len=%d", evt->data_len);
-            
-            // 分配或扩展缓冲区
-            if (response_data.buffer == NULL) {
-                response_data.size = evt->data_len + 1;
-                response_data.buffer = malloc(response_data.size);
-                if (response_data.buffer == NULL) {
-                    ESP_LOGE(TAG, "Failed to allocate response buffer");
-                    return ESP_FAIL;
-                }
-                response_data.length = 0;
-            } else if (response_data.length + evt->data_len >= response_data.size) {
-                size_t new_size = response_data.size + evt->data_len + 1;
-                char *new_buffer = realloc(response_data.buffer, new_size);
-                if (new_buffer == NULL) {
-                    ESP_LOGE(TAG, "Failed to reallocate response buffer");
-                    free(response_data.buffer);
-                    response_data.buffer = NULL;
-                    return ESP_FAIL;
-                }
-                response_data.buffer = new_buffer;
-                response_data.size = new_size;
+            s_body_bytes += evt->data_len;
+            if (s_body_bytes > CONFIG_WEATHER_MAX_RESPONSE_SIZE && !s_overflow) {
+                s_overflow = true;
+                ESP_LOGW(TAG, "Response exceeds %d bytes", CONFIG_WEATHER_MAX_RESPONSE_SIZE);
+            }
+#if CONFIG_WEATHER_RESPONSE_OVERFLOW_STREAM
+            // 增量解析不需要缓冲区，超长的响应照样流式解析
+            if (state != NULL && !s_provider->parse_feed(state, evt->data, evt->data_len)) {
+#else
+            // 超长后丢弃剩余数据，请求按失败处理
+            if (state != NULL && !s_overflow && !s_provider->parse_feed(state, evt->data, evt->data_len)) {
+#endif
+                ESP_LOGE(TAG, "Malformed %s response", s_provider->name);
             }
-            
-            // 复制数据到缓冲区
-            memcpy(response_data.buffer + response_data.length, evt->data, evt->data_len);
-            response_data.length += evt->data_len;
-            response_data.buffer[response_data.length] = '\0';
             break;
-            
+
         case HTTP_EVENT_ON_FINISH:
-            ESP_LOGI(TAG, "HTTP_EVENT_ON_FINISH");
+            ESP_LOGD(TAG, "HTTP_EVENT_ON_FINISH");
             break;
-            
+
+        case HTTP_EVENT_DISCONNECTED:
+            ESP_LOGD(TAG, "HTTP_EVENT_DISCONNECTED");
+            break;
+
         default:
             break;
     }
     return ESP_OK;
 }
 
-bool get_weather_info(char *weather, char *temperature, int weather_len)
+// 拆分"scheme://host[:port]"
+static void parse_api_base(weather_server_t *server, const char *base)
 {
-    // 重置响应数据
-    if (response_data.buffer) {
-        free(response_data.buffer);
-        response_data.buffer = NULL;
+    const char *sep = strstr(base, "://");
+    const char *host = sep ? sep + 3 : base;
+    snprintf(server->scheme, sizeof(server->scheme), "%.*s", sep ? (int)(sep - base) : 4, sep ? base : "http");
+
+    size_t host_len = strcspn(host, ":/");
+    snprintf(server->host, sizeof(server->host), "%.*s", (int)host_len, host);
+
+    bool https = strcmp(server->scheme, "https") == 0;
+    server->port = host[host_len] == ':' ? atoi(host + host_len + 1) : (https ? 443 : 80);
+    if (server->port == (https ? 443 : 80)) {
+        snprintf(server->host_header, sizeof(server->host_header), "%s", server->host);
+    } else {
+        snprintf(server->host_header, sizeof(server->host_header), "%s:%d", server->host, server->port);
     }
-    response_data.size = 0;
-    response_data.length = 0;
-    
-    // 构建完整的API URL - 使用HTTP而不是HTTPS
-    char url[256];
-    snprintf(url, sizeof(url), 
-             "http://api.seniverse.com/v3/weather/now.json?key=%s&location=%s&language=%s&unit=%s",
-             WEATHER_API_KEY, WEATHER_LOCATION, WEATHER_LANGUAGE, WEATHER_UNIT);
-    
-    ESP_LOGI(TAG, "Requesting weather from: %s", url);
-    
+}
+
+static const weather_server_t *server_of(const weather_provider_t *provider)
+{
+    for (size_t i = 0; i < WEATHER_PROVIDER_COUNT; i++) {
+        if (s_servers[i].provider == provider) {
+            return &s_servers[i];
+        }
+    }
+    return NULL;
+}
+
+void weather_init(void)
+{
+    if (s_server != NULL) {
+        return;
+    }
+    for (size_t i = 0; i < WEATHER_PROVIDER_COUNT; i++) {
+        weather_server_t *server = &s_servers[i];
+        server->provider = s_providers[i];
+        if (server->provider->base == NULL) {
+            continue;
+        }
+#ifdef WEATHER_API_BASE
+        parse_api_base(server, WEATHER_API_BASE);
+#else
+        parse_api_base(server, server->provider->base);
+#endif
+    }
+    s_server = server_of(s_provider);
+}
+
+const char *weather_api_host(void)
+{
+    // 只读一次指针，和切换数据源并发时拿到的也是某一个数据源完整的服务器
+    const weather_server_t *server = s_server;
+    if (server == NULL || server->provider->base == NULL) {
+        return NULL;
+    }
+    return server->host;
+}
+
+// 服务器部分由这里拼，路径和参数由数据源给出
+static void build_urls(const char *addr)
+{
+    for (int req = 0; req < WEATHER_REQ_COUNT; req++) {
+        weather_endpoint_t *ep = &s_endpoints[req];
+        int len = snprintf(ep->url, sizeof(ep->url), "%s://%s:%d", s_server->scheme, addr, s_server->port);
+        if (s_provider->build_path(req, ep->url + len, sizeof(ep->url) - len) < 0) {
+            ep->url[0] = '\0';
+        }
+    }
+}
+
+// 从DNS缓存取服务器地址（通常直接命中），地址变化时重建URL；解析失败返回false
+static bool refresh_server_address(void)
+{
+    struct in_addr addr;
+    if (dns_cache_lookup(s_server->host, &addr) != ESP_OK) {
+        ESP_LOGE(TAG, "Cannot resolve %s", s_server->host);
+        return false;
+    }
+
+    char text[16];
+    inet_ntoa_r(addr, text, sizeof(text));
+    if (strcmp(text, s_api_addr) != 0) {
+        if (s_api_addr[0] != '\0') {
+            ESP_LOGI(TAG, "Server address changed: %s -> %s", s_api_addr, text);
+        }
+        snprintf(s_api_addr, sizeof(s_api_addr), "%s", text);
+        build_urls(s_api_addr);
+        s_host_header_set = false;
+    }
+    return true;
+}
+
+static esp_http_client_handle_t get_client(void)
+{
+    if (s_client != NULL) {
+        return s_client;
+    }
+
     esp_http_client_config_t config = {
-        .url = url,
+        .url = s_endpoints[WEATHER_REQ_NOW].url,
+        // URL里是DNS缓存给出的IP，证书校验和SNI用原主机名
+        .common_name = s_server->host,
         .event_handler = _http_event_handler,
         .timeout_ms = 15000,  // 增加到15秒
+        // 收发缓冲区在创建句柄时分配一次，之后所有请求复用
+        .buffer_size = CONFIG_WEATHER_HTTP_RX_BUFFER_SIZE,
+        .buffer_size_tx = CONFIG_WEATHER_HTTP_TX_BUFFER_SIZE,
         .disable_auto_redirect = false,  // 允许重定向
+        // TCP keep-alive探测空闲连接，服务器悄悄断开后能及时发现
+        .keep_alive_enable = true,
+        .keep_alive_idle = 60,
+        .keep_alive_interval = 10,
+        .keep_alive_count = 3,
     };
-    
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (client == NULL) {
+
+    if (strcmp(s_server->scheme, "https") == 0) {
+#if CONFIG_WEATHER_TLS_CUSTOM_CA
+        config.cert_pem = stub_cert_pem_start;
+#else
+        config.crt_bundle_attach = esp_crt_bundle_attach;
+#endif
+#if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+        // 保存会话票据，同一句柄重新连接时走简短握手
+        config.save_client_session = true;
+#endif
+    }
+
+    s_client = esp_http_client_init(&config);
+    if (s_client == NULL) {
         ESP_LOGE(TAG, "Failed to initialize HTTP client");
-        return false;
+        return NULL;
     }
-    
-    // 设置HTTP头
-    esp_http_client_set_header(client, "User-Agent", "ESP32-Weather-Client");
-    esp_http_client_set_header(client, "Accept", "application/json");
-    
-    esp_err_t err = esp_http_client_perform(client);
-    bool success = false;
-    
-    if (err == ESP_OK) {
-        int status_code = esp_http_client_get_status_code(client);
-        ESP_LOGI(TAG, "HTTP Status: %d", status_code);
-        
-        if (status_code == 200) {
-            if (response_data.buffer != NULL && response_data.length > 0) {
-                ESP_LOGI(TAG, "Received JSON: %s", response_data.buffer);
-                
-                // 解析JSON
-                cJSON *root = cJSON_Parse(response_data.buffer);
-                if (root != NULL) {
-                    cJSON *results = cJSON_GetObjectItem(root, "results");
-                    if (results != NULL && cJSON_IsArray(results)) {
-                        int array_size = cJSON_GetArraySize(results);
-                        if (array_size > 0) {
-                            cJSON *result0 = cJSON_GetArrayItem(results, 0);
-                            if (result0 != NULL) {
-                                cJSON *now = cJSON_GetObjectItem(result0, "now");
-                                if (now != NULL) {
-                                    cJSON *text = cJSON_GetObjectItem(now, "text");
-                                    cJSON *temp = cJSON_GetObjectItem(now, "temperature");
-                                    
-                                    if (text != NULL && temp != NULL) {
-                                        // 安全复制天气信息
-                                        const char *weather_text = cJSON_GetStringValue(text);
-                                        const char *temp_text = cJSON_GetStringValue(temp);
-                                        
-                                        if (weather_text && temp_text) {
-                                            strncpy(weather, weather_text, weather_len - 1);
-                                            weather[weather_len - 1] = '\0';
-                                            
-                                            strncpy(temperature, temp_text, 6);
-                                            temperature[6] = '\0';
-                                            //strcat(temperature, "°C");
-                                            
-                                            success = true;
-                                            ESP_LOGI(TAG, "Weather parsed successfully: %s, %s", weather, temperature);
-                                        }
-                                    } else {
-                                        ESP_LOGE(TAG, "Text or temperature field is NULL");
-                                    }
-                                } else {
-                                    ESP_LOGE(TAG, "No 'now' object in response");
-                                }
-                            } else {
-                                ESP_LOGE(TAG, "First result is NULL");
-                            }
-                        } else {
-                            ESP_LOGE(TAG, "Results array is empty");
-                        }
-                    } else {
-                        ESP_LOGE(TAG, "No results field or not an array");
-                        
-                        // 检查错误信息
-                        cJSON *error_msg = cJSON_GetObjectItem(root, "status");
-                        if (error_msg != NULL) {
-                            ESP_LOGE(TAG, "API Error: %s", cJSON_GetStringValue(error_msg));
-                        }
-                    }
-                    cJSON_Delete(root);
-                } else {
-                    ESP_LOGE(TAG, "Failed to parse JSON response");
-                    const char *error_ptr = cJSON_GetErrorPtr();
-                    if (error_ptr != NULL) {
-                        ESP_LOGE(TAG, "JSON error before: %s", error_ptr);
-                    }
-                }
-            } else {
-                ESP_LOGE(TAG, "No response data received");
-            }
-        } else {
-            ESP_LOGE(TAG, "HTTP request failed with status: %d", status_code);
-        }
+
+    // 设置HTTP头（之后的请求都带着）
+    esp_http_client_set_header(s_client, "User-Agent", "ESP32-Weather-Client");
+    esp_http_client_set_header(s_client, "Accept", "application/json");
+    esp_http_client_set_header(s_client, "Connection", "keep-alive");
+    s_host_header_set = false;
+    s_sent_etag[0] = '\0';
+    s_sent_last_modified[0] = '\0';
+    return s_client;
+}
+
+// 把句柄上的头改成value（空字符串表示删除），sent记录当前值，相同时不调用
+static void update_header(esp_http_client_handle_t client, const char *key, const char *value,
+                          char *sent, size_t sent_size)
+{
+    if (strcmp(value, sent) == 0) {
+        return;
+    }
+    if (value[0] != '\0') {
+        esp_http_client_set_header(client, key, value);
+    } else {
+        esp_http_client_delete_header(client, key);
+    }
+    snprintf(sent, sent_size, "%s", value);
+}
+
+// 有校验值时带上条件头，没有时删掉上次可能留下的头（头在长连接句柄上一直保留）
+static void set_conditional_headers(esp_http_client_handle_t client, const weather_endpoint_t *ep)
+{
+    update_header(client, "If-None-Match", s_force_refresh ? "" : ep->etag, s_sent_etag, sizeof(s_sent_etag));
+    update_header(client, "If-Modified-Since", s_force_refresh ? "" : ep->last_modified, s_sent_last_modified,
+                  sizeof(s_sent_last_modified));
+}
+
+static void drop_client(void)
+{
+    if (s_client != NULL) {
+        esp_http_client_cleanup(s_client);
+        s_client = NULL;
+    }
+}
+
+// 记录一次请求的连接耗时（含DNS）和请求耗时
+static void record_timing(int64_t start_us, int64_t end_us)
+{
+    uint32_t connect_us = 0;
+    uint32_t request_us;
+
+    s_stats.requests++;
+    if (s_connected_us != 0) {
+        connect_us = (uint32_t)(s_connected_us - start_us);
+        request_us = (uint32_t)(end_us - s_connected_us);
+        s_stats.connects++;
+        s_stats.last_connect_us = connect_us;
+        s_total_connect_us += connect_us;
+        s_stats.avg_connect_us = (uint32_t)(s_total_connect_us / s_stats.connects);
+        if (connect_us > s_stats.max_connect_us) s_stats.max_connect_us = connect_us;
     } else {
-        ESP_LOGE(TAG, "HTTP request failed: %s", esp_err_to_name(err));
-        
+        request_us = (uint32_t)(end_us - start_us);
+        s_stats.reused++;
+    }
+    s_total_request_us += request_us;
+    s_stats.avg_request_us = (uint32_t)(s_total_request_us / s_stats.requests);
+    if (request_us > s_stats.max_request_us) s_stats.max_request_us = request_us;
+
+    ESP_LOGI(TAG, "Request timing: connect %lu us%s%s, request %lu us",
+             connect_us, s_connected_us && strcmp(s_server->scheme, "https") == 0 ? " (incl. TLS)" : "",
+             s_connected_us ? "" : " (reused)", request_us);
+}
+
+// 在长连接上请求一个接口，响应交给数据源解析，返回HTTP状态码，失败返回-1
+static int perform_request(weather_request_t req, weather_parse_state_t *state)
+{
+    weather_endpoint_t *ep = &s_endpoints[req];
+    if (!refresh_server_address()) {
+        s_stats.failures++;
+        return -1;
+    }
+    if (ep->url[0] == '\0') {
+        ESP_LOGE(TAG, "Provider %s has no %s endpoint", s_provider->name, ep->name);
+        return -1;
+    }
+    esp_http_client_handle_t client = get_client();
+    if (client == NULL) {
+        return -1;
+    }
+    ESP_LOGD(TAG, "Requesting weather from: %s", ep->url);
+    // 同一主机只换路径，set_url不会断开已有连接；URL里是IP，Host头改回主机名
+    esp_http_client_set_url(client, ep->url);
+    if (!s_host_header_set) {
+        esp_http_client_set_header(client, "Host", s_server->host_header);
+        s_host_header_set = true;
+    }
+    set_conditional_headers(client, ep);
+
+    // 复用的连接可能已经被服务器关掉，这种情况下关闭后在新连接上重试一次
+    for (int attempt = 0; attempt < 2; attempt++) {
+        s_provider->parse_begin(state, req);
+        esp_http_client_set_user_data(client, state);
+        s_connected_us = 0;
+        s_pending_etag[0] = '\0';
+        s_pending_last_modified[0] = '\0';
+        s_body_bytes = 0;
+        s_overflow = false;
+
+        int64_t start = esp_timer_get_time();
+        esp_err_t err = esp_http_client_perform(client);
+        int64_t end = esp_timer_get_time();
+
+        if (err == ESP_OK) {
+            record_timing(start, end);
+            return esp_http_client_get_status_code(client);
+        }
+
+        s_stats.failures++;
+        bool reused = s_connected_us == 0;
+        ESP_LOGW(TAG, "HTTP request (%s) failed on %s connection: %s",
+                 ep->name, reused ? "reused" : "new", esp_err_to_name(err));
+
         // 获取HTTP客户端错误代码
         int http_errno = esp_http_client_get_errno(client);
         if (http_errno != 0) {
             ESP_LOGE(TAG, "HTTP client error code: %d", http_errno);
         }
+
+        if (!reused) {
+            break;
+        }
+        esp_http_client_close(client);
+    }
+
+    // 新连接也失败：释放句柄，地址也可能已经变了，下次重新解析并创建
+    drop_client();
+    dns_cache_invalidate(s_server->host);
+    return -1;
+}
+
+// 数据没变（last_update和上次相同）时返回UNCHANGED，否则记下新的last_update
+static weather_fetch_result_t check_update(weather_endpoint_t *ep, const weather_report_t *out)
+{
+    if (!s_force_refresh && out->last_update[0] != '\0' && strcmp(out->last_update, ep->last_update) == 0) {
+        s_stats.unchanged++;
+        ESP_LOGI(TAG, "Weather %s unchanged since %s", ep->name, out->last_update);
+        return WEATHER_FETCH_UNCHANGED;
+    }
+    snprintf(ep->last_update, sizeof(ep->last_update), "%s", out->last_update);
+    s_stats.full_updates++;
+    return WEATHER_FETCH_UPDATED;
+}
+
+// 检查响应：状态码、解析结果和是否与上次相同，返回UPDATED时out中是新数据
+static weather_fetch_result_t check_response(weather_endpoint_t *ep, int status_code,
+                                             weather_parse_state_t *state, weather_report_t *out)
+{
+    if (status_code < 0) {
+        return WEATHER_FETCH_FAILED;
+    }
+    ESP_LOGI(TAG, "HTTP Status (%s): %d", ep->name, status_code);
+
+    if (s_overflow) {
+        s_stats.overflows++;
+#if !CONFIG_WEATHER_RESPONSE_OVERFLOW_STREAM
+        ESP_LOGE(TAG, "Weather %s response too large (%u bytes), discarded", ep->name, (unsigned)s_body_bytes);
+        return WEATHER_FETCH_FAILED;
+#endif
+    }
+
+    // 条件请求命中：没有响应体，什么都不用解析
+    if (status_code == 304) {
+        s_stats.not_modified++;
+        ESP_LOGI(TAG, "Weather %s not modified (304)", ep->name);
+        return WEATHER_FETCH_UNCHANGED;
+    }
+
+    bool parsed = s_provider->parse_finish(state, out);
+    if (status_code != 200) {
+        ESP_LOGE(TAG, "HTTP request failed with status: %d", status_code);
+        // 出错时数据源从响应体里取出原因
+        if (out->error[0] != '\0') {
+            ESP_LOGE(TAG, "API Error: %s", out->error);
+        }
+        return WEATHER_FETCH_FAILED;
     }
-    
-    esp_http_client_cleanup(client);
-    
-    // 清理响应数据
-    if (response_data.buffer) {
-        free(response_data.buffer);
-        response_data.buffer = NULL;
-    }
-    response_data.size = 0;
-    response_data.length = 0;
-    
-    return success;
-}
\ No newline at end of file
+
+    if (!parsed) {
+        ESP_LOGE(TAG, "Weather %s response rejected by %s: %s", ep->name, s_provider->name, out->error);
+        // 响应可能没读完，连接状态不确定，关掉下次重连
+        esp_http_client_close(s_client);
+        return WEATHER_FETCH_FAILED;
+    }
+
+    // 服务器不支持条件请求时，用数据自带的last_update判断是否有新数据
+    snprintf(ep->etag, sizeof(ep->etag), "%s", s_pending_etag);
+    snprintf(ep->last_modified, sizeof(ep->last_modified), "%s", s_pending_last_modified);
+    return check_update(ep, out);
+}
+
+// 不走HTTP的数据源：整个请求算作一次复用连接的请求
+static weather_fetch_result_t fetch_direct(weather_request_t req, weather_report_t *out)
+{
+    weather_endpoint_t *ep = &s_endpoints[req];
+    int64_t start = esp_timer_get_time();
+    bool ok = s_provider->fetch(req, out);
+    s_connected_us = 0;
+    record_timing(start, esp_timer_get_time());
+
+    if (!ok) {
+        s_stats.failures++;
+        ESP_LOGE(TAG, "Weather %s from %s failed: %s", ep->name, s_provider->name, out->error);
+        return WEATHER_FETCH_FAILED;
+    }
+    return check_update(ep, out);
+}
+
+weather_fetch_result_t weather_fetch(weather_request_t req, weather_report_t *out)
+{
+    if (req >= WEATHER_REQ_COUNT || out == NULL) {
+        return WEATHER_FETCH_FAILED;
+    }
+
+    weather_fetch_result_t result;
+    if (s_provider->fetch != NULL) {
+        result = fetch_direct(req, out);
+    } else {
+        // 解析状态在栈上，整个请求不分配响应缓冲区
+        weather_parse_state_t state;
+        int status_code = perform_request(req, &state);
+        result = check_response(&s_endpoints[req], status_code, &state, out);
+    }
+    if (result != WEATHER_FETCH_UPDATED) {
+        return result;
+    }
+
+    if (req == WEATHER_REQ_DAILY) {
+        ESP_LOGI(TAG, "Forecast parsed: %d days, updated %s", out->forecast.count,
+                 out->last_update[0] ? out->last_update : "N/A");
+    } else {
+        ESP_LOGI(TAG, "Weather parsed successfully: %s, %s, code=%d, updated %s", out->text, out->temperature,
+                 out->code, out->last_update[0] ? out->last_update : "N/A");
+    }
+    return WEATHER_FETCH_UPDATED;
+}
+
+void weather_set_provider(const weather_provider_t *provider)
+{
+    const weather_server_t *server = server_of(provider);
+    if (provider == NULL || provider == s_provider || server == NULL) {
+        return;
+    }
+    ESP_LOGI(TAG, "Weather provider: %s -> %s", s_provider->name, provider->name);
+
+    // 换了服务器和数据格式：连接、地址和上次的校验值都作废
+    drop_client();
+    s_provider = provider;
+    s_server = server;
+    s_api_addr[0] = '\0';
+    for (int req = 0; req < WEATHER_REQ_COUNT; req++) {
+        s_endpoints[req].url[0] = '\0';
+        s_endpoints[req].etag[0] = '\0';
+        s_endpoints[req].last_modified[0] = '\0';
+        s_endpoints[req].last_update[0] = '\0';
+    }
+}
+
+const weather_provider_t *weather_get_provider(void)
+{
+    return s_provider;
+}
+
+const weather_provider_t *weather_provider_find(const char *name)
+{
+    for (size_t i = 0; i < WEATHER_PROVIDER_COUNT; i++) {
+        if (name != NULL && strcmp(s_providers[i]->name, name) == 0) {
+            return s_providers[i];
+        }
+    }
+    return NULL;
+}
+
+void weather_set_force_refresh(bool force)
+{
+    s_force_refresh = force;
+}
+
+void weather_get_client_stats(weather_client_stats_t *stats)
+{
+    if (stats) {
+        *stats = s_stats;
+    }
+}
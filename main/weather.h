@@ -2,7 +2,52 @@
 #define WEATHER_H
 
 #include <stdbool.h>
+#include <stdint.h>
+#include "weather_provider.h"
 
-bool get_weather_info(char *weather, char *temperature, int weather_len);
+// HTTP客户端统计：连接耗时（含DNS、TCP建连）和请求耗时分开记录
+typedef struct {
+    uint32_t requests;        // 成功完成的请求数
+    uint32_t connects;        // 其中新建连接的次数
+    uint32_t reused;          // 其中复用长连接的次数
+    uint32_t failures;        // 失败的请求尝试次数
+    uint32_t avg_connect_us;
+    uint32_t max_connect_us;
+    uint32_t last_connect_us; // 最近一次建连耗时（HTTPS时含握手，会话恢复后明显变短）
+    uint32_t avg_request_us;
+    uint32_t max_request_us;
+    uint32_t full_updates;    // 取到新数据的次数
+    uint32_t not_modified;    // 条件请求返回304、没有响应体的次数
+    uint32_t unchanged;       // 返回了完整响应但last_update没变的次数
+    uint32_t overflows;       // 响应体超过CONFIG_WEATHER_MAX_RESPONSE_SIZE的次数
+} weather_client_stats_t;
 
-#endif
\ No newline at end of file
+// 一次天气请求的结果
+typedef enum {
+    WEATHER_FETCH_FAILED = 0,
+    WEATHER_FETCH_UPDATED,    // 取到新数据，输出参数已填写
+    WEATHER_FETCH_UNCHANGED,  // 数据和上次相同（304或last_update未变），不需要发布
+} weather_fetch_result_t;
+
+// 向当前数据源请求实况（WEATHER_REQ_NOW）或今天起WEATHER_FORECAST_DAYS天的逐日预报（WEATHER_REQ_DAILY），
+// 结果是统一的weather_report_t；两种请求复用同一个长连接。
+// 服务器给出ETag/Last-Modified时之后的请求带条件头，数据没变就不再解析和发布
+weather_fetch_result_t weather_fetch(weather_request_t req, weather_report_t *out);
+
+// 切换数据源（连接和校验值随之重置），只能在天气任务中调用
+void weather_set_provider(const weather_provider_t *provider);
+const weather_provider_t *weather_get_provider(void);
+
+// 强制刷新：不带条件头、不按last_update去重，每次请求都当作新数据（基准测试用）
+void weather_set_force_refresh(bool force);
+
+// 解析各数据源的服务器地址，要在任何任务用到天气客户端之前调用一次（weather_service_start中调用）
+void weather_init(void);
+
+// 天气API服务器的主机名（用于联网后预解析，任意任务可调用），数据源不走网络或尚未初始化时返回NULL
+const char *weather_api_host(void);
+
+// 获取HTTP客户端统计
+void weather_get_client_stats(weather_client_stats_t *stats);
+
+#endif
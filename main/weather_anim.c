@@ -0,0 +1,497 @@
+#include "weather_anim.h"
+#include "fonts.h"
+#include "widget.h"
+#include "app_cores.h"
+#include "power_mgmt.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "WEATHER_ANIM";
+
+// 动画参数
+#define ANIM_TILE_SIZE          8
+#define ANIM_TILES_PER_ROW      (WEATHER_ANIM_ICON_SIZE / ANIM_TILE_SIZE)
+#define ANIM_TILE_COUNT         (ANIM_TILES_PER_ROW * ANIM_TILES_PER_ROW)
+#define ANIM_FRAME_COUNT        8
+#define ANIM_FRAME_PERIOD_US    (125 * 1000)        // 8帧/秒
+#define ANIM_STATS_INTERVAL_US  (10 * 1000 * 1000)  // 10秒统计一次
+
+// 任务通知位
+#define ANIM_EVT_TICK  (1 << 0)
+#define ANIM_EVT_KIND  (1 << 1)
+#define ANIM_EVT_RESTART (1 << 2)
+
+// 颜色（与图集中的静态图标一致）
+#define ANIM_COLOR_SUN        COLOR_YELLOW
+#define ANIM_COLOR_CLOUD      COLOR_WHITE
+#define ANIM_COLOR_RAIN_CLOUD 0xC618
+#define ANIM_COLOR_DROP       0x5D9F
+
+// 一个变化块：块序号 + 8x8像素
+typedef struct {
+    uint8_t index;
+    uint16_t pixels[ANIM_TILE_SIZE * ANIM_TILE_SIZE];
+} anim_tile_t;
+
+// 一帧的增量：在tiles数组中的起始位置和数量
+typedef struct {
+    uint16_t first;
+    uint8_t count;
+} anim_frame_t;
+
+// 动画片段：关键帧 + 每帧相对上一帧的块增量（第0帧相对最后一帧，便于循环）
+typedef struct {
+    weather_anim_kind_t kind;
+    uint16_t key_frame[WEATHER_ANIM_ICON_SIZE * WEATHER_ANIM_ICON_SIZE];
+    anim_frame_t frames[ANIM_FRAME_COUNT];
+    anim_tile_t tiles[ANIM_FRAME_COUNT * ANIM_TILE_COUNT];
+    uint16_t tile_total;
+} anim_clip_t;
+
+static lcd_display_t *s_lcd = NULL;
+static uint16_t s_x = 0;
+static uint16_t s_y = 0;
+static TaskHandle_t s_task = NULL;
+static esp_timer_handle_t s_timer = NULL;
+static volatile weather_anim_kind_t s_pending_kind = WEATHER_ANIM_NONE;
+static SemaphoreHandle_t s_draw_lock = NULL;  // 动画任务处理一次事件期间持有
+static bool s_paused = false;                 // 暂停期间不画任何东西（持s_draw_lock修改）
+
+static anim_clip_t s_clip;
+static uint8_t s_next_frame = 0;
+
+// 编码和播放用的临时缓冲区
+static uint16_t s_canvas[2][WEATHER_ANIM_ICON_SIZE * WEATHER_ANIM_ICON_SIZE];
+static uint16_t s_run[WEATHER_ANIM_ICON_SIZE * ANIM_TILE_SIZE];
+
+// 统计
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static weather_anim_stats_t s_stats = {0};
+static int64_t s_win_start_us = 0;
+static uint32_t s_win_frames = 0;
+static uint32_t s_win_bytes = 0;
+static uint32_t s_win_tiles = 0;
+static uint32_t s_win_cpu_us = 0;
+static uint32_t s_win_max_cpu_us = 0;
+
+// ---------------- 画布绘制 ----------------
+
+static void canvas_fill_bg(uint16_t *canvas)
+{
+    // 背景取自整屏背景图对应位置
+    for (int y = 0; y < WEATHER_ANIM_ICON_SIZE; y++) {
+        memcpy(&canvas[y * WEATHER_ANIM_ICON_SIZE],
+               &thunderGod[(s_y + y) * 128 + s_x],
+               WEATHER_ANIM_ICON_SIZE * sizeof(uint16_t));
+    }
+}
+
+static void canvas_put(uint16_t *canvas, int x, int y, uint16_t color)
+{
+    if (x < 0 || y < 0 || x >= WEATHER_ANIM_ICON_SIZE || y >= WEATHER_ANIM_ICON_SIZE) return;
+    canvas[y * WEATHER_ANIM_ICON_SIZE + x] = color;
+}
+
+static void canvas_fill_circle(uint16_t *canvas, int cx, int cy, int r, uint16_t color)
+{
+    for (int dy = -r; dy <= r; dy++) {
+        for (int dx = -r; dx <= r; dx++) {
+            if (dx * dx + dy * dy <= r * r) {
+                canvas_put(canvas, cx + dx, cy + dy, color);
+            }
+        }
+    }
+}
+
+static void canvas_line(uint16_t *canvas, int x0, int y0, int x1, int y1, uint16_t color)
+{
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    while (1) {
+        canvas_put(canvas, x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+static void canvas_cloud(uint16_t *canvas, int ox, int oy, uint16_t color)
+{
+    canvas_fill_circle(canvas, ox + 7, oy + 11, 4, color);
+    canvas_fill_circle(canvas, ox + 12, oy + 8, 5, color);
+    canvas_fill_circle(canvas, ox + 17, oy + 11, 4, color);
+    for (int y = oy + 11; y <= oy + 15; y++) {
+        canvas_line(canvas, ox + 7, y, ox + 17, y, color);
+    }
+}
+
+// 按类型和帧号绘制一帧
+static void render_frame(weather_anim_kind_t kind, int frame, uint16_t *canvas)
+{
+    canvas_fill_bg(canvas);
+
+    switch (kind) {
+        case WEATHER_ANIM_SUN: {
+            // 太阳光芒旋转
+            canvas_fill_circle(canvas, 12, 12, 5, ANIM_COLOR_SUN);
+            float phase = (float)M_PI / 4.0f * frame / ANIM_FRAME_COUNT;
+            for (int k = 0; k < 8; k++) {
+                float a = k * (float)M_PI / 4.0f + phase;
+                canvas_line(canvas,
+                            12 + lroundf(7 * cosf(a)), 12 + lroundf(7 * sinf(a)),
+                            12 + lroundf(10 * cosf(a)), 12 + lroundf(10 * sinf(a)),
+                            ANIM_COLOR_SUN);
+            }
+            break;
+        }
+        case WEATHER_ANIM_CLOUD: {
+            // 云朵左右飘动
+            int ox = lroundf(2.0f * sinf(2.0f * (float)M_PI * frame / ANIM_FRAME_COUNT));
+            canvas_cloud(canvas, ox, 2, ANIM_COLOR_CLOUD);
+            break;
+        }
+        case WEATHER_ANIM_RAIN: {
+            // 雨滴下落
+            static const int drop_x[] = {7, 12, 17};
+            static const int drop_phase[] = {0, 5, 2};
+            canvas_cloud(canvas, 0, -2, ANIM_COLOR_RAIN_CLOUD);
+            for (int k = 0; k < 3; k++) {
+                int y = 15 + (frame + drop_phase[k]) % ANIM_FRAME_COUNT;
+                canvas_line(canvas, drop_x[k], y, drop_x[k] - 1, y + 2, ANIM_COLOR_DROP);
+            }
+            break;
+        }
+        case WEATHER_ANIM_SNOW: {
+            // 雪花缓慢飘落
+            static const int flake_x[] = {6, 12, 18};
+            static const int flake_phase[] = {0, 4, 2};
+            canvas_cloud(canvas, 0, -2, ANIM_COLOR_RAIN_CLOUD);
+            for (int k = 0; k < 3; k++) {
+                int y = 15 + (frame + flake_phase[k]) % ANIM_FRAME_COUNT;
+                canvas_put(canvas, flake_x[k], y, COLOR_WHITE);
+                canvas_put(canvas, flake_x[k] - 1, y, COLOR_WHITE);
+                canvas_put(canvas, flake_x[k] + 1, y, COLOR_WHITE);
+                canvas_put(canvas, flake_x[k], y - 1, COLOR_WHITE);
+                canvas_put(canvas, flake_x[k], y + 1, COLOR_WHITE);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// ---------------- 增量编码 ----------------
+
+static bool tile_differs(const uint16_t *a, const uint16_t *b, int tile)
+{
+    int tx = (tile % ANIM_TILES_PER_ROW) * ANIM_TILE_SIZE;
+    int ty = (tile / ANIM_TILES_PER_ROW) * ANIM_TILE_SIZE;
+    for (int y = ty; y < ty + ANIM_TILE_SIZE; y++) {
+        if (memcmp(&a[y * WEATHER_ANIM_ICON_SIZE + tx], &b[y * WEATHER_ANIM_ICON_SIZE + tx],
+                   ANIM_TILE_SIZE * sizeof(uint16_t)) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void tile_copy_out(const uint16_t *canvas, int tile, uint16_t *dst)
+{
+    int tx = (tile % ANIM_TILES_PER_ROW) * ANIM_TILE_SIZE;
+    int ty = (tile / ANIM_TILES_PER_ROW) * ANIM_TILE_SIZE;
+    for (int y = 0; y < ANIM_TILE_SIZE; y++) {
+        memcpy(&dst[y * ANIM_TILE_SIZE], &canvas[(ty + y) * WEATHER_ANIM_ICON_SIZE + tx],
+               ANIM_TILE_SIZE * sizeof(uint16_t));
+    }
+}
+
+// 生成关键帧和逐帧块增量
+static void encode_clip(weather_anim_kind_t kind)
+{
+    uint16_t *prev = s_canvas[0];
+    uint16_t *cur = s_canvas[1];
+
+    s_clip.kind = kind;
+    s_clip.tile_total = 0;
+
+    // 第0帧的增量相对于最后一帧，保证循环播放连续
+    render_frame(kind, ANIM_FRAME_COUNT - 1, prev);
+
+    for (int f = 0; f < ANIM_FRAME_COUNT; f++) {
+        render_frame(kind, f, cur);
+        if (f == 0) {
+            memcpy(s_clip.key_frame, cur, sizeof(s_clip.key_frame));
+        }
+
+        s_clip.frames[f].first = s_clip.tile_total;
+        s_clip.frames[f].count = 0;
+        for (int t = 0; t < ANIM_TILE_COUNT; t++) {
+            if (tile_differs(prev, cur, t)) {
+                anim_tile_t *tile = &s_clip.tiles[s_clip.tile_total++];
+                tile->index = t;
+                tile_copy_out(cur, t, tile->pixels);
+                s_clip.frames[f].count++;
+            }
+        }
+
+        uint16_t *tmp = prev;
+        prev = cur;
+        cur = tmp;
+    }
+
+    ESP_LOGI(TAG, "Clip %d encoded: %d delta tiles over %d frames (raw %d)",
+             kind, s_clip.tile_total, ANIM_FRAME_COUNT, ANIM_FRAME_COUNT * ANIM_TILE_COUNT);
+}
+
+// ---------------- 播放 ----------------
+
+// 推送一帧的变化块，同一行相邻的块合并成一次窗口写入
+static uint32_t play_frame(const anim_frame_t *frame)
+{
+    uint32_t bytes_before = s_lcd->bus_bytes;
+    uint16_t i = 0;
+
+    while (i < frame->count) {
+        const anim_tile_t *first = &s_clip.tiles[frame->first + i];
+        int row = first->index / ANIM_TILES_PER_ROW;
+        int run = 1;
+        while (i + run < frame->count) {
+            const anim_tile_t *next = &s_clip.tiles[frame->first + i + run];
+            if (next->index != first->index + run || next->index / ANIM_TILES_PER_ROW != row) break;
+            run++;
+        }
+
+        int run_w = run * ANIM_TILE_SIZE;
+        for (int k = 0; k < run; k++) {
+            const anim_tile_t *tile = &s_clip.tiles[frame->first + i + k];
+            for (int y = 0; y < ANIM_TILE_SIZE; y++) {
+                memcpy(&s_run[y * run_w + k * ANIM_TILE_SIZE], &tile->pixels[y * ANIM_TILE_SIZE],
+                       ANIM_TILE_SIZE * sizeof(uint16_t));
+            }
+        }
+
+        lcd_write_region(s_lcd,
+                         s_x + (first->index % ANIM_TILES_PER_ROW) * ANIM_TILE_SIZE,
+                         s_y + row * ANIM_TILE_SIZE,
+                         run_w, ANIM_TILE_SIZE, s_run);
+        i += run;
+    }
+
+    return s_lcd->bus_bytes - bytes_before;
+}
+
+static void update_stats(uint32_t bytes, uint32_t tiles, uint32_t cpu_us)
+{
+    s_win_frames++;
+    s_win_bytes += bytes;
+    s_win_tiles += tiles;
+    s_win_cpu_us += cpu_us;
+    if (cpu_us > s_win_max_cpu_us) s_win_max_cpu_us = cpu_us;
+
+    int64_t now = esp_timer_get_time();
+    int64_t elapsed = now - s_win_start_us;
+    if (elapsed < ANIM_STATS_INTERVAL_US) return;
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.frames += s_win_frames;
+    s_stats.fps = s_win_frames * 1000000.0f / elapsed;
+    s_stats.avg_bus_bytes = s_win_bytes / s_win_frames;
+    s_stats.avg_tiles = s_win_tiles / s_win_frames;
+    s_stats.avg_cpu_us = s_win_cpu_us / s_win_frames;
+    s_stats.max_cpu_us = s_win_max_cpu_us;
+    s_stats.cpu_load = s_win_cpu_us * 100.0f / elapsed;
+    weather_anim_stats_t snapshot = s_stats;
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    ESP_LOGI(TAG, "Anim: %.1f fps, %lu B/frame, %lu tiles/frame, CPU %lu us/frame (max %lu), load %.2f%%",
+             snapshot.fps, snapshot.avg_bus_bytes, snapshot.avg_tiles,
+             snapshot.avg_cpu_us, snapshot.max_cpu_us, snapshot.cpu_load);
+
+    s_win_start_us = now;
+    s_win_frames = 0;
+    s_win_bytes = 0;
+    s_win_tiles = 0;
+    s_win_cpu_us = 0;
+    s_win_max_cpu_us = 0;
+}
+
+static void restart_clip(void)
+{
+    lcd_write_region(s_lcd, s_x, s_y, WEATHER_ANIM_ICON_SIZE, WEATHER_ANIM_ICON_SIZE, s_clip.key_frame);
+    s_next_frame = 1;
+}
+
+static void switch_clip(weather_anim_kind_t kind)
+{
+    esp_timer_stop(s_timer);
+
+    if (kind == WEATHER_ANIM_NONE) {
+        // 没有动画时只停止播放，图标区域由天气区域自己重绘
+        s_clip.kind = WEATHER_ANIM_NONE;
+        return;
+    }
+
+    encode_clip(kind);
+    restart_clip();
+
+    s_win_start_us = esp_timer_get_time();
+    esp_timer_start_periodic(s_timer, ANIM_FRAME_PERIOD_US);
+}
+
+static void anim_task(void *arg)
+{
+    while (1) {
+        uint32_t events = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+        xSemaphoreTake(s_draw_lock, portMAX_DELAY);
+        if (s_paused) {
+            // 暂停期间的类型切换和重播在恢复时统一处理
+            xSemaphoreGive(s_draw_lock);
+            continue;
+        }
+        power_mgmt_acquire(POWER_LOCK_RENDER);
+
+        if (events & ANIM_EVT_KIND) {
+            weather_anim_kind_t kind = s_pending_kind;
+            if (kind != s_clip.kind) {
+                switch_clip(kind);
+                events &= ~ANIM_EVT_RESTART; // 切换时已经画过关键帧
+            }
+        }
+
+        if ((events & ANIM_EVT_RESTART) && s_clip.kind != WEATHER_ANIM_NONE) {
+            restart_clip();
+        }
+
+        // 渲染帧进行中时让出这一拍（不前进帧号，下一拍接着播）
+        if ((events & ANIM_EVT_TICK) && s_clip.kind != WEATHER_ANIM_NONE && !widget_frame_in_progress()) {
+            const anim_frame_t *frame = &s_clip.frames[s_next_frame];
+            int64_t start = esp_timer_get_time();
+            uint32_t bytes = play_frame(frame);
+            uint32_t cpu_us = (uint32_t)(esp_timer_get_time() - start);
+            s_next_frame = (s_next_frame + 1) % ANIM_FRAME_COUNT;
+            update_stats(bytes, frame->count, cpu_us);
+        }
+        power_mgmt_release(POWER_LOCK_RENDER);
+        xSemaphoreGive(s_draw_lock);
+    }
+}
+
+static void anim_timer_callback(void *arg)
+{
+    xTaskNotify(s_task, ANIM_EVT_TICK, eSetBits);
+}
+
+esp_err_t weather_anim_init(lcd_display_t *lcd, uint16_t x, uint16_t y)
+{
+    if (lcd == NULL || x + WEATHER_ANIM_ICON_SIZE > lcd->width || y + WEATHER_ANIM_ICON_SIZE > lcd->height) {
+        ESP_LOGE(TAG, "Invalid parameters in weather_anim_init");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    s_lcd = lcd;
+    s_x = x;
+    s_y = y;
+    s_clip.kind = WEATHER_ANIM_NONE;
+
+    s_draw_lock = xSemaphoreCreateMutex();
+    if (s_draw_lock == NULL) {
+        ESP_LOGE(TAG, "Failed to create animation mutex");
+        return ESP_ERR_NO_MEM;
+    }
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = anim_timer_callback,
+        .name = "weather_anim",
+        .skip_unhandled_events = true,
+    };
+    esp_err_t ret = esp_timer_create(&timer_args, &s_timer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create animation timer: %s", esp_err_to_name(ret));
+        vSemaphoreDelete(s_draw_lock);
+        s_draw_lock = NULL;
+        return ret;
+    }
+
+    // 优先级不高于主循环，动画不能抢占时钟刷新；和渲染任务在同一个核心上
+    if (xTaskCreatePinnedToCore(anim_task, "weather_anim", 3072, NULL, tskIDLE_PRIORITY + 1,
+                                &s_task, APP_CORE_RENDER) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create animation task");
+        esp_timer_delete(s_timer);
+        s_timer = NULL;
+        vSemaphoreDelete(s_draw_lock);
+        s_draw_lock = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Weather animation ready at (%d,%d)", x, y);
+    return ESP_OK;
+}
+
+void weather_anim_set_kind(weather_anim_kind_t kind)
+{
+    if (s_task == NULL || kind == s_pending_kind) {
+        return;
+    }
+    s_pending_kind = kind;
+    xTaskNotify(s_task, ANIM_EVT_KIND, eSetBits);
+}
+
+void weather_anim_restart(void)
+{
+    if (s_task == NULL) {
+        return;
+    }
+    xTaskNotify(s_task, ANIM_EVT_RESTART, eSetBits);
+}
+
+void weather_anim_pause(bool paused)
+{
+    if (s_task == NULL) {
+        return;
+    }
+
+    // 持锁修改，返回时正在画的一帧已经画完
+    xSemaphoreTake(s_draw_lock, portMAX_DELAY);
+    s_paused = paused;
+    xSemaphoreGive(s_draw_lock);
+
+    // 图标区域可能已被覆盖，从关键帧重播；暂停期间的类型切换也在这时处理
+    if (!paused) {
+        xTaskNotify(s_task, ANIM_EVT_KIND | ANIM_EVT_RESTART, eSetBits);
+    }
+}
+
+weather_anim_kind_t weather_anim_kind_from_icon(weather_icon_t icon)
+{
+    // 只有第0帧与图集图标完全一致的图标才有动画
+    switch (icon) {
+        case WEATHER_ICON_SUNNY:  return WEATHER_ANIM_SUN;
+        case WEATHER_ICON_CLOUDY: return WEATHER_ANIM_CLOUD;
+        case WEATHER_ICON_RAIN:   return WEATHER_ANIM_RAIN;
+        case WEATHER_ICON_SNOW:   return WEATHER_ANIM_SNOW;
+        default:                  return WEATHER_ANIM_NONE;
+    }
+}
+
+void weather_anim_get_stats(weather_anim_stats_t *stats)
+{
+    if (stats == NULL) return;
+
+    portENTER_CRITICAL(&s_stats_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_stats_lock);
+}
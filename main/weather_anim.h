@@ -0,0 +1,51 @@
+#ifndef WEATHER_ANIM_H
+#define WEATHER_ANIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "lcd_driver.h"
+#include "weather_icons.h"
+
+// 天气动画图标尺寸（与图集图标一致，第0帧就是图集中的静态图标）
+#define WEATHER_ANIM_ICON_SIZE WEATHER_ICON_SIZE
+
+// 动画类型
+typedef enum {
+    WEATHER_ANIM_NONE = 0,
+    WEATHER_ANIM_SUN,
+    WEATHER_ANIM_CLOUD,
+    WEATHER_ANIM_RAIN,
+    WEATHER_ANIM_SNOW,
+} weather_anim_kind_t;
+
+// 动画运行统计（每个统计周期更新一次）
+typedef struct {
+    uint32_t frames;         // 累计播放帧数
+    float fps;               // 最近统计周期内的实际帧率
+    uint32_t avg_bus_bytes;  // 平均每帧SPI总线字节数
+    uint32_t avg_tiles;      // 平均每帧推送的变化块数
+    uint32_t avg_cpu_us;     // 平均每帧CPU耗时（微秒）
+    uint32_t max_cpu_us;     // 最大每帧CPU耗时（微秒）
+    float cpu_load;          // 动画占用的CPU百分比
+} weather_anim_stats_t;
+
+// 初始化动画播放器，图标绘制在(x, y)开始的24x24区域
+esp_err_t weather_anim_init(lcd_display_t *lcd, uint16_t x, uint16_t y);
+
+// 切换动画类型（线程安全，实际切换在动画任务中完成）
+void weather_anim_set_kind(weather_anim_kind_t kind);
+
+// 从关键帧重新播放（图标区域被其他绘制覆盖后调用）
+void weather_anim_restart(void);
+
+// 暂停/恢复播放（同步：暂停返回后不会再绘制；恢复时从关键帧重播，用于基准测试等独占屏幕的场合）
+void weather_anim_pause(bool paused);
+
+// 根据图标选择动画类型，没有对应动画的图标返回WEATHER_ANIM_NONE
+weather_anim_kind_t weather_anim_kind_from_icon(weather_icon_t icon);
+
+// 获取动画运行统计
+void weather_anim_get_stats(weather_anim_stats_t *stats);
+
+#endif
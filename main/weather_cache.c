@@ -0,0 +1,150 @@
+#include "weather_cache.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "WEATHER_CACHE";
+
+#define WEATHER_CACHE_NAMESPACE "weather"
+#define WEATHER_CACHE_KEY       "now"
+#define WEATHER_CACHE_MAGIC     0x57434831  // "WCH1"，结构变化时修改
+
+// 早于这个时间的系统时间视为未同步（与主循环的判断一致）
+#define WEATHER_CACHE_VALID_EPOCH 1609459200
+
+// NVS中保存的格式
+typedef struct {
+    uint32_t magic;
+    char weather[32];
+    char temperature[8];
+    int32_t code;
+    int64_t updated;
+} weather_cache_record_t;
+
+static weather_cache_record_t s_stored;       // NVS中当前的内容
+static bool s_stored_valid = false;
+static int64_t s_last_write_us = 0;           // 上次写入的esp_timer时间，0表示本次启动还没写过
+static weather_cache_record_t s_pending;      // 被限流、还没写入的最新内容
+static bool s_pending_valid = false;
+static uint32_t s_writes = 0;
+static uint32_t s_skipped = 0;
+
+static bool same_content(const weather_cache_record_t *a, const weather_cache_record_t *b)
+{
+    return strcmp(a->weather, b->weather) == 0 && strcmp(a->temperature, b->temperature) == 0 &&
+           a->code == b->code;
+}
+
+esp_err_t weather_cache_load(weather_snapshot_t *out)
+{
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(WEATHER_CACHE_NAMESPACE, NVS_READONLY, &handle);
+    if (ret != ESP_OK) {
+        // 第一次运行时命名空间还不存在
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    weather_cache_record_t record;
+    size_t len = sizeof(record);
+    ret = nvs_get_blob(handle, WEATHER_CACHE_KEY, &record, &len);
+    nvs_close(handle);
+    if (ret != ESP_OK || len != sizeof(record) || record.magic != WEATHER_CACHE_MAGIC) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    record.weather[sizeof(record.weather) - 1] = '\0';
+    record.temperature[sizeof(record.temperature) - 1] = '\0';
+
+    s_stored = record;
+    s_stored_valid = true;
+
+    memset(out, 0, sizeof(*out));
+    snprintf(out->weather, sizeof(out->weather), "%s", record.weather);
+    snprintf(out->temperature, sizeof(out->temperature), "%s", record.temperature);
+    out->code = record.code;
+    out->updated = (time_t)record.updated;
+
+    // 时间还没同步时无法判断缓存新旧，先按过期显示
+    time_t now = time(NULL);
+    out->stale = now < WEATHER_CACHE_VALID_EPOCH || now - out->updated > WEATHER_CACHE_TTL_S;
+
+    ESP_LOGI(TAG, "Loaded cached weather: %s, %s (code %d)%s", out->weather, out->temperature, out->code,
+             out->stale ? ", stale" : "");
+    return ESP_OK;
+}
+
+static bool write_allowed(int64_t now_us)
+{
+    return s_last_write_us == 0 || now_us - s_last_write_us >= (int64_t)WEATHER_CACHE_WRITE_INTERVAL_S * 1000000;
+}
+
+static void write_record(const weather_cache_record_t *record, int64_t now_us)
+{
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(WEATHER_CACHE_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS: %s", esp_err_to_name(ret));
+        return;
+    }
+    ret = nvs_set_blob(handle, WEATHER_CACHE_KEY, record, sizeof(*record));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+
+    // 写失败时保留待写内容，下一轮再试
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write weather cache: %s", esp_err_to_name(ret));
+        s_pending = *record;
+        s_pending_valid = true;
+        return;
+    }
+
+    s_stored = *record;
+    s_stored_valid = true;
+    s_pending_valid = false;
+    s_last_write_us = now_us;
+    s_writes++;
+    ESP_LOGI(TAG, "Weather cache written (%lu writes, %lu skipped)", s_writes, s_skipped);
+}
+
+void weather_cache_store(const weather_snapshot_t *snapshot)
+{
+    weather_cache_record_t record = { .magic = WEATHER_CACHE_MAGIC };
+    snprintf(record.weather, sizeof(record.weather), "%s", snapshot->weather);
+    snprintf(record.temperature, sizeof(record.temperature), "%s", snapshot->temperature);
+    record.code = snapshot->code;
+    record.updated = (int64_t)snapshot->updated;
+
+    // 内容没变时不写；但时间戳太旧时要刷新，否则重启后会把刚确认过的数据显示成过期
+    if (s_stored_valid && same_content(&record, &s_stored) &&
+        record.updated - s_stored.updated < WEATHER_CACHE_TTL_S / 2) {
+        // NVS里已经是最新内容，之前被限流的旧数据不用再写
+        s_pending_valid = false;
+        s_skipped++;
+        return;
+    }
+
+    int64_t now_us = esp_timer_get_time();
+    if (!write_allowed(now_us)) {
+        // 限流：只保留最新的一份，间隔到期后由weather_cache_flush写入
+        s_pending = record;
+        s_pending_valid = true;
+        s_skipped++;
+        return;
+    }
+
+    write_record(&record, now_us);
+}
+
+void weather_cache_flush(void)
+{
+    if (!s_pending_valid) {
+        return;
+    }
+    int64_t now_us = esp_timer_get_time();
+    if (write_allowed(now_us)) {
+        write_record(&s_pending, now_us);
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef WEATHER_CACHE_H
+#define WEATHER_CACHE_H
+
+#include <stdbool.h>
+#include "esp_err.h"
+#include "weather_service.h"
+
+// 天气缓存：最近一次成功获取的天气保存在NVS里，开机后联网之前就能显示
+
+// 超过这个时间的缓存显示为过期
+#define WEATHER_CACHE_TTL_S          (3 * 60 * 60)
+// 两次写NVS的最小间隔（内容没变时不写），减少flash磨损
+#define WEATHER_CACHE_WRITE_INTERVAL_S (30 * 60)
+
+// 读取缓存到out（version不填），没有缓存返回ESP_ERR_NOT_FOUND；
+// out->stale在系统时间无效或超过TTL时为true
+esp_err_t weather_cache_load(weather_snapshot_t *out);
+
+// 保存快照（只在天气任务中调用），内容没变时不写；距离上次写入不足间隔时先记下，
+// 由weather_cache_flush在间隔到期后写入
+void weather_cache_store(const weather_snapshot_t *snapshot);
+
+// 写入被限流的快照（只在天气任务中调用，每轮刷新后调用一次），间隔未到或没有待写数据时什么都不做
+void weather_cache_flush(void);
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef WEATHER_ICONS_H
+#define WEATHER_ICONS_H
+
+#include "lcd_driver.h"
+
+// 天气图标尺寸（像素）
+#define WEATHER_ICON_SIZE 24
+
+// 图集中的图标，顺序与图集中的排列一致
+typedef enum {
+    WEATHER_ICON_SUNNY = 0,
+    WEATHER_ICON_CLEAR_NIGHT,
+    WEATHER_ICON_PARTLY_CLOUDY,
+    WEATHER_ICON_CLOUDY,
+    WEATHER_ICON_OVERCAST,
+    WEATHER_ICON_SHOWER,
+    WEATHER_ICON_THUNDER,
+    WEATHER_ICON_RAIN,
+    WEATHER_ICON_SLEET,
+    WEATHER_ICON_SNOW,
+    WEATHER_ICON_FOG,
+    WEATHER_ICON_DUST,
+    WEATHER_ICON_WIND,
+    WEATHER_ICON_UNKNOWN,
+    WEATHER_ICON_COUNT
+} weather_icon_t;
+
+// 天气图标图集（所有图标打包在一张图中）
+extern const lcd_atlas_t weather_icon_atlas;
+
+// 心知天气code转换为图标，code无效时返回WEATHER_ICON_UNKNOWN
+weather_icon_t weather_icon_from_code(int code);
+
+// 获取图标在图集中的源矩形
+const lcd_rect_t *weather_icon_rect(weather_icon_t icon);
+
+// 在(x, y)绘制图标（一次窗口写入）
+esp_err_t weather_icon_draw(lcd_display_t *lcd, weather_icon_t icon, uint16_t x, uint16_t y);
+
+#endif
@@ -0,0 +1,411 @@
+#include "weather_json.h"
+#include <string.h>
+
+// 解析状态
+enum {
+    S_VALUE = 0,     // 期待一个值
+    S_ARR_FIRST,     // '['之后：值或']'
+    S_OBJ_FIRST,     // '{'之后：键或'}'
+    S_OBJ_KEY,       // ','之后：键
+    S_COLON,         // 键之后：':'
+    S_STRING,        // 字符串内部
+    S_ESCAPE,        // '\'之后
+    S_UNICODE,       // \uXXXX
+    S_LITERAL,       // 数字、true/false/null
+    S_AFTER,         // 值之后：','或结束括号
+};
+
+// 需要识别的键
+enum {
+    KEY_OTHER = 0,
+    KEY_RESULTS,
+    KEY_NOW,
+    KEY_TEXT,
+    KEY_CODE,
+    KEY_TEMPERATURE,
+    KEY_LAST_UPDATE,
+    KEY_STATUS,
+    KEY_DAILY,
+    KEY_DATE,
+    KEY_CODE_DAY,
+    KEY_HIGH,
+    KEY_LOW,
+};
+
+static const struct {
+    const char *name;
+    uint8_t id;
+} s_keys[] = {
+    { "results", KEY_RESULTS },
+    { "now", KEY_NOW },
+    { "text", KEY_TEXT },
+    { "code", KEY_CODE },
+    { "temperature", KEY_TEMPERATURE },
+    { "last_update", KEY_LAST_UPDATE },
+    { "status", KEY_STATUS },
+    { "daily", KEY_DAILY },
+    { "date", KEY_DATE },
+    { "code_day", KEY_CODE_DAY },
+    { "high", KEY_HIGH },
+    { "low", KEY_LOW },
+};
+
+#define KEY_OVERFLOW 0xFF
+
+void weather_json_init(weather_json_parser_t *p, weather_now_t *out)
+{
+    memset(p, 0, sizeof(*p));
+    memset(out, 0, sizeof(*out));
+    p->out = out;
+    p->state = S_VALUE;
+}
+
+void weather_json_init_daily(weather_json_parser_t *p, weather_now_t *out, weather_json_daily_t *daily)
+{
+    weather_json_init(p, out);
+    memset(daily, 0, sizeof(*daily));
+    p->daily = daily;
+}
+
+static bool is_ws(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static uint8_t lookup_key(const weather_json_parser_t *p)
+{
+    if (p->key_len == KEY_OVERFLOW) {
+        return KEY_OTHER;
+    }
+    for (size_t i = 0; i < sizeof(s_keys) / sizeof(s_keys[0]); i++) {
+        if (strcmp(p->key_buf, s_keys[i].name) == 0) {
+            return s_keys[i].id;
+        }
+    }
+    return KEY_OTHER;
+}
+
+// 当前位置在results[0]对象里（深度至少为3）
+static bool in_result0(const weather_json_parser_t *p)
+{
+    return !p->stack[0].is_array && p->stack[0].key == KEY_RESULTS &&
+           p->stack[1].is_array && p->stack[1].index == 0 &&
+           !p->stack[2].is_array;
+}
+
+static void set_dest(weather_json_parser_t *p, char *buf, size_t cap, uint8_t field)
+{
+    p->dest = buf;
+    p->dest_cap = (uint8_t)cap;
+    p->dest_len = 0;
+    p->dest_field = field;
+    buf[0] = '\0';
+}
+
+// results[0].daily[i]中的值，只取前WEATHER_JSON_DAYS天
+static void select_daily_dest(weather_json_parser_t *p, uint8_t key)
+{
+    if (p->stack[2].key != KEY_DAILY || !p->stack[3].is_array || p->stack[4].is_array) {
+        return;
+    }
+    uint16_t index = p->stack[3].index;
+    if (index >= WEATHER_JSON_DAYS) {
+        return;
+    }
+
+    weather_json_day_t *day = &p->daily->days[index];
+    if (key == KEY_DATE) {
+        set_dest(p, day->date, sizeof(day->date), 0);
+    } else if (key == KEY_CODE_DAY) {
+        set_dest(p, day->code_day, sizeof(day->code_day), 0);
+    } else if (key == KEY_HIGH) {
+        set_dest(p, day->high, sizeof(day->high), 0);
+    } else if (key == KEY_LOW) {
+        set_dest(p, day->low, sizeof(day->low), 0);
+    } else {
+        return;
+    }
+    if (p->daily->count < index + 1) {
+        p->daily->count = (uint8_t)(index + 1);
+    }
+}
+
+// 值开始时根据路径决定写到哪个字段，不需要的值直接丢弃
+static void select_dest(weather_json_parser_t *p)
+{
+    weather_now_t *out = p->out;
+    p->dest = NULL;
+
+    if (p->depth == 0 || p->stack[p->depth - 1].is_array) {
+        return;
+    }
+    uint8_t key = p->stack[p->depth - 1].key;
+
+    if (p->depth == 1 && key == KEY_STATUS) {
+        set_dest(p, out->status, sizeof(out->status), WEATHER_JSON_STATUS);
+    } else if (p->depth == 3 && in_result0(p) && key == KEY_LAST_UPDATE) {
+        set_dest(p, out->last_update, sizeof(out->last_update), WEATHER_JSON_LAST_UPDATE);
+    } else if (p->depth == 4 && in_result0(p) && p->stack[2].key == KEY_NOW) {
+        if (key == KEY_TEXT) {
+            set_dest(p, out->text, sizeof(out->text), WEATHER_JSON_TEXT);
+        } else if (key == KEY_CODE) {
+            set_dest(p, out->code, sizeof(out->code), WEATHER_JSON_CODE);
+        } else if (key == KEY_TEMPERATURE) {
+            set_dest(p, out->temperature, sizeof(out->temperature), WEATHER_JSON_TEMPERATURE);
+        }
+    } else if (p->depth == 5 && p->daily != NULL && in_result0(p)) {
+        select_daily_dest(p, key);
+    }
+}
+
+static void put_char(weather_json_parser_t *p, char c)
+{
+    if (p->in_key) {
+        if (p->key_len != KEY_OVERFLOW) {
+            if (p->key_len < sizeof(p->key_buf) - 1) {
+                p->key_buf[p->key_len++] = c;
+                p->key_buf[p->key_len] = '\0';
+            } else {
+                p->key_len = KEY_OVERFLOW;
+            }
+        }
+        return;
+    }
+    if (p->dest && p->dest_len < p->dest_cap - 1) {
+        p->dest[p->dest_len++] = c;
+        p->dest[p->dest_len] = '\0';
+    }
+}
+
+// \uXXXX按UTF-8写出（不处理代理对，写成'?'）
+static void put_unicode(weather_json_parser_t *p, uint16_t cp)
+{
+    if (cp < 0x80) {
+        put_char(p, (char)cp);
+    } else if (cp < 0x800) {
+        put_char(p, (char)(0xC0 | (cp >> 6)));
+        put_char(p, (char)(0x80 | (cp & 0x3F)));
+    } else if (cp >= 0xD800 && cp <= 0xDFFF) {
+        put_char(p, '?');
+    } else {
+        put_char(p, (char)(0xE0 | (cp >> 12)));
+        put_char(p, (char)(0x80 | ((cp >> 6) & 0x3F)));
+        put_char(p, (char)(0x80 | (cp & 0x3F)));
+    }
+}
+
+static void end_value(weather_json_parser_t *p)
+{
+    if (p->dest) {
+        p->out->found |= p->dest_field;
+        p->dest = NULL;
+    }
+    p->state = S_AFTER;
+}
+
+static bool push(weather_json_parser_t *p, bool is_array)
+{
+    if (p->depth >= WEATHER_JSON_MAX_DEPTH) {
+        return false;
+    }
+    p->stack[p->depth].is_array = is_array;
+    p->stack[p->depth].key = KEY_OTHER;
+    p->stack[p->depth].index = 0;
+    p->depth++;
+    p->state = is_array ? S_ARR_FIRST : S_OBJ_FIRST;
+    return true;
+}
+
+static void pop(weather_json_parser_t *p)
+{
+    p->depth--;
+    p->state = S_AFTER;
+}
+
+static void begin_key(weather_json_parser_t *p)
+{
+    p->in_key = 1;
+    p->key_len = 0;
+    p->key_buf[0] = '\0';
+    p->state = S_STRING;
+}
+
+// 处理一个值的第一个字符
+static bool begin_value(weather_json_parser_t *p, char c)
+{
+    switch (c) {
+        case '{':
+            return push(p, false);
+        case '[':
+            return push(p, true);
+        case '"':
+            select_dest(p);
+            p->in_key = 0;
+            p->state = S_STRING;
+            return true;
+        default:
+            if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n') {
+                select_dest(p);
+                p->in_key = 0;
+                put_char(p, c);
+                p->state = S_LITERAL;
+                return true;
+            }
+            return false;
+    }
+}
+
+static bool hex_value(char c, uint8_t *v)
+{
+    if (c >= '0' && c <= '9') *v = c - '0';
+    else if (c >= 'a' && c <= 'f') *v = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') *v = c - 'A' + 10;
+    else return false;
+    return true;
+}
+
+bool weather_json_feed(weather_json_parser_t *p, const char *data, size_t len)
+{
+    if (p->error) {
+        return false;
+    }
+
+    size_t i = 0;
+    while (i < len && !p->done) {
+        char c = data[i];
+        bool ok = true;
+
+        switch (p->state) {
+            case S_VALUE:
+                if (!is_ws(c)) ok = begin_value(p, c);
+                break;
+
+            case S_ARR_FIRST:
+                if (c == ']') pop(p);
+                else if (!is_ws(c)) ok = begin_value(p, c);
+                break;
+
+            case S_OBJ_FIRST:
+                if (c == '}') pop(p);
+                else if (c == '"') begin_key(p);
+                else ok = is_ws(c);
+                break;
+
+            case S_OBJ_KEY:
+                if (c == '"') begin_key(p);
+                else ok = is_ws(c);
+                break;
+
+            case S_COLON:
+                if (c == ':') p->state = S_VALUE;
+                else ok = is_ws(c);
+                break;
+
+            case S_STRING:
+                if (c == '"') {
+                    if (p->in_key) {
+                        p->stack[p->depth - 1].key = lookup_key(p);
+                        p->in_key = 0;
+                        p->state = S_COLON;
+                    } else {
+                        end_value(p);
+                    }
+                } else if (c == '\\') {
+                    p->state = S_ESCAPE;
+                } else {
+                    put_char(p, c);
+                }
+                break;
+
+            case S_ESCAPE:
+                p->state = S_STRING;
+                switch (c) {
+                    case 'n': put_char(p, '\n'); break;
+                    case 't': put_char(p, '\t'); break;
+                    case 'r': put_char(p, '\r'); break;
+                    case 'b': put_char(p, '\b'); break;
+                    case 'f': put_char(p, '\f'); break;
+                    case 'u':
+                        p->unicode = 0;
+                        p->unicode_digits = 0;
+                        p->state = S_UNICODE;
+                        break;
+                    default: put_char(p, c); break; // '"'、'\\'、'/'
+                }
+                break;
+
+            case S_UNICODE: {
+                uint8_t v;
+                ok = hex_value(c, &v);
+                if (ok) {
+                    p->unicode = (uint16_t)((p->unicode << 4) | v);
+                    if (++p->unicode_digits == 4) {
+                        put_unicode(p, p->unicode);
+                        p->state = S_STRING;
+                    }
+                }
+                break;
+            }
+
+            case S_LITERAL:
+                if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '.' || c == '+' || c == '-' ||
+                    c == 'E') {
+                    put_char(p, c);
+                } else {
+                    // 字面量没有结束符，遇到下一个字符时结束，这个字符按S_AFTER重新处理
+                    end_value(p);
+                    continue;
+                }
+                break;
+
+            case S_AFTER:
+                if (p->depth == 0) {
+                    p->done = true;
+                } else if (c == ',') {
+                    if (p->stack[p->depth - 1].is_array) {
+                        p->stack[p->depth - 1].index++;
+                        p->state = S_VALUE;
+                    } else {
+                        p->state = S_OBJ_KEY;
+                    }
+                } else if (c == '}' && !p->stack[p->depth - 1].is_array) {
+                    pop(p);
+                } else if (c == ']' && p->stack[p->depth - 1].is_array) {
+                    pop(p);
+                } else {
+                    ok = is_ws(c);
+                }
+                break;
+
+            default:
+                ok = false;
+                break;
+        }
+
+        if (!ok) {
+            p->error = true;
+            return false;
+        }
+        i++;
+    }
+
+    // 顶层值刚好在这块数据末尾结束
+    if (p->state == S_AFTER && p->depth == 0) {
+        p->done = true;
+    }
+    return true;
+}
+
+bool weather_json_finish(weather_json_parser_t *p)
+{
+    // 顶层是字面量时只能在数据结束时才知道它结束了
+    if (!p->error && p->state == S_LITERAL && p->depth == 0) {
+        end_value(p);
+        p->done = true;
+    }
+    if (p->daily != NULL) {
+        return !p->error && p->done && p->daily->count > 0;
+    }
+    const uint8_t required = WEATHER_JSON_TEXT | WEATHER_JSON_TEMPERATURE;
+    return !p->error && p->done && (p->out->found & required) == required;
+}
@@ -0,0 +1,82 @@
+#ifndef WEATHER_JSON_H
+#define WEATHER_JSON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// 天气响应的流式提取器：不建DOM、不分配内存，HTTP数据块到达时直接喂进来，
+// 只把results[0].now.{text,code,temperature}、results[0].last_update和出错时的status取出来；
+// 逐日预报响应再取results[0].daily[i].{date,code_day,high,low}的前WEATHER_JSON_DAYS天
+// （不依赖ESP-IDF，可以在Linux主机上编译做基准测试）
+
+// 已取到的字段
+#define WEATHER_JSON_TEXT        (1 << 0)
+#define WEATHER_JSON_CODE        (1 << 1)
+#define WEATHER_JSON_TEMPERATURE (1 << 2)
+#define WEATHER_JSON_LAST_UPDATE (1 << 3)
+#define WEATHER_JSON_STATUS      (1 << 4)
+
+// 提取结果（字符串超长时截断）
+typedef struct {
+    char text[32];
+    char code[8];
+    char temperature[8];
+    char last_update[32];
+    char status[64];          // API出错时的说明
+    uint8_t found;            // WEATHER_JSON_*
+} weather_now_t;
+
+// 逐日预报（daily.json）中的一天
+typedef struct {
+    char date[12];            // "2024-05-01"
+    char code_day[4];         // 白天天气现象代码
+    char high[6];
+    char low[6];
+} weather_json_day_t;
+
+#define WEATHER_JSON_DAYS 3
+
+typedef struct {
+    weather_json_day_t days[WEATHER_JSON_DAYS];
+    uint8_t count;            // 取到的天数
+} weather_json_daily_t;
+
+#define WEATHER_JSON_MAX_DEPTH 8
+
+// 解析器状态（全部在结构体内，调用方放在栈上即可）
+typedef struct {
+    weather_now_t *out;
+    weather_json_daily_t *daily; // 非NULL时解析逐日预报
+    uint8_t state;
+    uint8_t depth;
+    struct {
+        uint8_t is_array;
+        uint8_t key;          // 对象中当前成员的键
+        uint16_t index;       // 数组中当前元素的下标
+    } stack[WEATHER_JSON_MAX_DEPTH];
+    char key_buf[16];         // 正在读取的键（只需要识别几个短键）
+    uint8_t key_len;
+    char *dest;               // 当前值写入的位置，NULL表示丢弃
+    uint8_t dest_cap;
+    uint8_t dest_len;
+    uint8_t dest_field;
+    uint8_t in_key;           // 正在读的字符串是键
+    uint16_t unicode;         // \uXXXX累加值
+    uint8_t unicode_digits;
+    bool error;
+    bool done;                // 顶层值已经结束
+} weather_json_parser_t;
+
+void weather_json_init(weather_json_parser_t *p, weather_now_t *out);
+
+// 解析逐日预报响应：last_update和status仍写到out中
+void weather_json_init_daily(weather_json_parser_t *p, weather_now_t *out, weather_json_daily_t *daily);
+
+// 喂入一块数据，出现语法错误时返回false（之后的数据都被忽略）
+bool weather_json_feed(weather_json_parser_t *p, const char *data, size_t len);
+
+// 数据结束：顶层值完整且取到了天气文字和温度（逐日预报为至少一天）时返回true
+bool weather_json_finish(weather_json_parser_t *p);
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef WEATHER_PROVIDER_H
+#define WEATHER_PROVIDER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// 天气数据源接口：构造请求、增量解析响应、输出统一的结果结构。
+// HTTP传输（长连接、条件请求、DNS缓存、重试）在weather.c中，和具体数据源无关
+
+// 请求类型：一次刷新先取实况，再在同一个连接上取逐日预报
+typedef enum {
+    WEATHER_REQ_NOW = 0,
+    WEATHER_REQ_DAILY,
+    WEATHER_REQ_COUNT,
+} weather_request_t;
+
+// 逐日预报：紧凑的定长结构，可以直接放进快照按值传递
+#define WEATHER_FORECAST_DAYS 3
+
+typedef struct {
+    uint8_t month;
+    uint8_t day;
+    int8_t code;              // 白天天气现象代码，-1表示未知
+    int8_t high;              // 最高温度
+    int8_t low;               // 最低温度
+} weather_forecast_day_t;
+
+typedef struct {
+    weather_forecast_day_t days[WEATHER_FORECAST_DAYS];
+    uint8_t count;            // 有效天数，0表示还没有预报
+} weather_forecast_t;
+
+// 统一的解析结果：实况请求填text/temperature/code，预报请求填forecast
+typedef struct {
+    char text[32];            // 天气文字
+    char temperature[8];      // 温度
+    int code;                 // 天气现象代码（心知天气编码），-1表示未知
+    weather_forecast_t forecast;
+    char last_update[32];     // 数据自带的更新时间，用于判断数据是否变化；空表示数据源不提供
+    char error[64];           // 失败原因（API返回的说明或解析错误）
+} weather_report_t;
+
+// 解析器状态：各数据源的增量解析器放在这块定长内存里，调用方放在栈上，请求过程不分配堆
+#define WEATHER_PARSE_STATE_SIZE 512
+
+typedef struct {
+    union {
+        uint8_t bytes[WEATHER_PARSE_STATE_SIZE];
+        uint64_t align;
+    };
+} weather_parse_state_t;
+
+typedef struct weather_provider {
+    const char *name;
+
+    // 默认服务器"scheme://host[:port]"，NULL表示不走HTTP（由fetch自己产生数据）
+    const char *base;
+
+    // 写入请求的路径和参数（不含scheme和主机），返回长度，不支持的请求返回-1
+    int (*build_path)(weather_request_t req, char *buf, size_t size);
+
+    // 开始解析一个响应；之后每个数据块调用parse_feed，语法错误时返回false（后续数据被忽略）
+    void (*parse_begin)(weather_parse_state_t *state, weather_request_t req);
+    bool (*parse_feed)(weather_parse_state_t *state, const char *data, size_t len);
+
+    // 响应结束：成功时填写out并返回true；失败时out->error说明原因。
+    // 非200响应也会调用，用来取出错误说明
+    bool (*parse_finish)(weather_parse_state_t *state, weather_report_t *out);
+
+    // 不走HTTP的数据源（base为NULL）：自己产生一次响应并解析到out，失败时out->error说明原因
+    bool (*fetch)(weather_request_t req, weather_report_t *out);
+} weather_provider_t;
+
+// 心知天气（api.seniverse.com v3）
+extern const weather_provider_t weather_provider_seniverse;
+
+// 本地脚本化模拟数据源：不联网，按脚本注入延迟、分块和错误，数据格式同心知天气
+extern const weather_provider_t weather_provider_mock;
+
+// 模拟数据源的故障类型
+typedef enum {
+    WEATHER_MOCK_ERROR_HTTP = 0,  // 返回HTTP 500和错误说明
+    WEATHER_MOCK_ERROR_TRUNCATE,  // 响应在中途断开，JSON不完整
+    WEATHER_MOCK_ERROR_TIMEOUT,   // 一直等不到响应，按客户端超时处理
+} weather_mock_error_t;
+
+// 模拟脚本：每个请求先等latency_ms，再按chunk_bytes分块喂给解析器，块间隔chunk_delay_ms；
+// fail_every不为0时每fail_every个请求按error失败一次
+typedef struct {
+    uint32_t latency_ms;
+    uint32_t chunk_bytes;
+    uint32_t chunk_delay_ms;
+    uint32_t fail_every;
+    weather_mock_error_t error;
+} weather_mock_script_t;
+
+void weather_mock_set_script(const weather_mock_script_t *script);
+void weather_mock_get_script(weather_mock_script_t *out);
+const char *weather_mock_error_name(weather_mock_error_t error);
+
+// 按名称查找数据源（"seniverse"、"mock"），找不到返回NULL
+const weather_provider_t *weather_provider_find(const char *name);
+
+#endif
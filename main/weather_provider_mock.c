@@ -0,0 +1,166 @@
+#include "weather_provider.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "WEATHER_MOCK";
+
+// 模拟数据源：按心知天气的格式现场生成响应，再用心知天气的解析器按脚本分块解析。
+// 不需要网络和服务器，用于基准测试和演示故障处理；每次请求的数据都不同，不会被去重
+
+// 默认脚本：接近真实API的延迟，响应按典型TCP分段大小到达
+static weather_mock_script_t s_script = {
+    .latency_ms = 150,
+    .chunk_bytes = 256,
+    .chunk_delay_ms = 2,
+    .fail_every = 0,
+    .error = WEATHER_MOCK_ERROR_HTTP,
+};
+static portMUX_TYPE s_script_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// 请求计数只由天气任务修改
+static uint32_t s_requests = 0;
+
+// 生成的响应体（只在天气任务中使用）
+static char s_body[768];
+
+// 轮换的天气现象（字库里都有这些字）
+static const struct {
+    const char *text;
+    int code;
+} s_conditions[] = {
+    { "晴", 0 },
+    { "多云", 4 },
+    { "阴", 9 },
+    { "小雨", 13 },
+};
+#define CONDITION_COUNT (sizeof(s_conditions) / sizeof(s_conditions[0]))
+
+static int build_body(weather_request_t req, uint32_t seq)
+{
+    // last_update随请求号变化，保证每次都是新数据
+    char update[32];
+    snprintf(update, sizeof(update), "2026-01-01T%02lu:%02lu:00+08:00", (seq / 60) % 24, seq % 60);
+
+    if (req == WEATHER_REQ_DAILY) {
+        int len = snprintf(s_body, sizeof(s_body), "{\"results\":[{\"location\":{\"name\":\"mock\"},\"daily\":[");
+        for (int i = 0; i < WEATHER_FORECAST_DAYS; i++) {
+            uint32_t c = (seq + i) % CONDITION_COUNT;
+            len += snprintf(s_body + len, sizeof(s_body) - len,
+                            "%s{\"date\":\"2026-01-%02d\",\"text_day\":\"%s\",\"code_day\":\"%d\",\"high\":\"%lu\",\"low\":\"%lu\"}",
+                            i ? "," : "", i + 1, s_conditions[c].text, s_conditions[c].code,
+                            15 + (seq + i) % 10, 5 + (seq + i) % 10);
+        }
+        len += snprintf(s_body + len, sizeof(s_body) - len, "],\"last_update\":\"%s\"}]}", update);
+        return len;
+    }
+
+    uint32_t c = seq % CONDITION_COUNT;
+    return snprintf(s_body, sizeof(s_body),
+                    "{\"results\":[{\"location\":{\"name\":\"mock\"},\"now\":{\"text\":\"%s\",\"code\":\"%d\","
+                    "\"temperature\":\"%lu\"},\"last_update\":\"%s\"}]}",
+                    s_conditions[c].text, s_conditions[c].code, 10 + seq % 20, update);
+}
+
+static void delay_ms(uint32_t ms)
+{
+    if (ms > 0) {
+        vTaskDelay(pdMS_TO_TICKS(ms) > 0 ? pdMS_TO_TICKS(ms) : 1);
+    }
+}
+
+static bool mock_fetch(weather_request_t req, weather_report_t *out)
+{
+    const weather_provider_t *parser = &weather_provider_seniverse;
+    weather_mock_script_t script;
+    weather_mock_get_script(&script);
+
+    uint32_t seq = ++s_requests;
+    bool fail = script.fail_every > 0 && seq % script.fail_every == 0;
+
+    // 首字节前的延迟（DNS、建连、服务器处理）
+    delay_ms(script.latency_ms);
+
+    if (fail && script.error == WEATHER_MOCK_ERROR_TIMEOUT) {
+        // 和HTTP客户端的超时时间一致
+        delay_ms(15000);
+        memset(out, 0, sizeof(*out));
+        snprintf(out->error, sizeof(out->error), "timeout (mock)");
+        return false;
+    }
+    if (fail && script.error == WEATHER_MOCK_ERROR_HTTP) {
+        snprintf(s_body, sizeof(s_body), "{\"status\":\"HTTP 500 (mock)\",\"status_code\":\"AP100001\"}");
+    } else {
+        build_body(req, seq);
+    }
+
+    // 按脚本分块喂给解析器，模拟HTTP_EVENT_ON_DATA
+    size_t len = strlen(s_body);
+    if (fail && script.error == WEATHER_MOCK_ERROR_TRUNCATE) {
+        len /= 2;
+    }
+    size_t chunk = script.chunk_bytes > 0 ? script.chunk_bytes : len;
+    weather_parse_state_t state;
+    parser->parse_begin(&state, req);
+    for (size_t off = 0; off < len; off += chunk) {
+        if (off > 0) {
+            delay_ms(script.chunk_delay_ms);
+        }
+        size_t n = len - off < chunk ? len - off : chunk;
+        if (!parser->parse_feed(&state, s_body + off, n)) {
+            break;
+        }
+    }
+
+    bool ok = parser->parse_finish(&state, out);
+    if (fail) {
+        if (script.error == WEATHER_MOCK_ERROR_TRUNCATE) {
+            snprintf(out->error, sizeof(out->error), "connection closed mid-response (mock)");
+        }
+        ESP_LOGW(TAG, "Injected %s failure on request %lu", weather_mock_error_name(script.error), seq);
+        return false;
+    }
+    return ok;
+}
+
+void weather_mock_set_script(const weather_mock_script_t *script)
+{
+    if (script == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_script_lock);
+    s_script = *script;
+    portEXIT_CRITICAL(&s_script_lock);
+}
+
+void weather_mock_get_script(weather_mock_script_t *out)
+{
+    if (out == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_script_lock);
+    *out = s_script;
+    portEXIT_CRITICAL(&s_script_lock);
+}
+
+const char *weather_mock_error_name(weather_mock_error_t error)
+{
+    switch (error) {
+        case WEATHER_MOCK_ERROR_HTTP:     return "http";
+        case WEATHER_MOCK_ERROR_TRUNCATE: return "truncate";
+        case WEATHER_MOCK_ERROR_TIMEOUT:  return "timeout";
+        default:                          return "?";
+    }
+}
+
+const weather_provider_t weather_provider_mock = {
+    .name = "mock",
+    .base = NULL,
+    .build_path = NULL,
+    .parse_begin = NULL,
+    .parse_feed = NULL,
+    .parse_finish = NULL,
+    .fetch = mock_fetch,
+};
@@ -0,0 +1,134 @@
+#include "weather_provider.h"
+#include "weather_json.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 心知天气API配置
+#define SENIVERSE_API_KEY  "SrqxKpth7Fvzao2Wi"
+#define SENIVERSE_LOCATION "hangzhou"
+#define SENIVERSE_LANGUAGE "zh-Hans"
+#define SENIVERSE_UNIT     "c"
+
+// HTTPS时TLS握手只在建立连接时做一次：长连接复用，连接断开后用保存的会话票据恢复会话
+#if CONFIG_WEATHER_USE_HTTPS
+#define SENIVERSE_API_BASE "https://api.seniverse.com"
+#else
+#define SENIVERSE_API_BASE "http://api.seniverse.com"
+#endif
+
+// 流式提取器和它的输出都放在调用方提供的解析状态里
+typedef struct {
+    weather_json_parser_t parser;
+    weather_now_t now;
+    weather_json_daily_t daily;
+    weather_request_t req;
+} seniverse_state_t;
+
+_Static_assert(sizeof(seniverse_state_t) <= WEATHER_PARSE_STATE_SIZE, "seniverse parse state too large");
+
+static int seniverse_build_path(weather_request_t req, char *buf, size_t size)
+{
+    switch (req) {
+        case WEATHER_REQ_NOW:
+            return snprintf(buf, size, "/v3/weather/now.json?key=%s&location=%s&language=%s&unit=%s",
+                            SENIVERSE_API_KEY, SENIVERSE_LOCATION, SENIVERSE_LANGUAGE, SENIVERSE_UNIT);
+        case WEATHER_REQ_DAILY:
+            return snprintf(buf, size,
+                            "/v3/weather/daily.json?key=%s&location=%s&language=%s&unit=%s&start=0&days=%d",
+                            SENIVERSE_API_KEY, SENIVERSE_LOCATION, SENIVERSE_LANGUAGE, SENIVERSE_UNIT,
+                            WEATHER_FORECAST_DAYS);
+        default:
+            return -1;
+    }
+}
+
+static void seniverse_parse_begin(weather_parse_state_t *state, weather_request_t req)
+{
+    seniverse_state_t *s = (seniverse_state_t *)state->bytes;
+    s->req = req;
+    if (req == WEATHER_REQ_DAILY) {
+        weather_json_init_daily(&s->parser, &s->now, &s->daily);
+    } else {
+        weather_json_init(&s->parser, &s->now);
+    }
+}
+
+static bool seniverse_parse_feed(weather_parse_state_t *state, const char *data, size_t len)
+{
+    seniverse_state_t *s = (seniverse_state_t *)state->bytes;
+    return weather_json_feed(&s->parser, data, len);
+}
+
+// 字符串温度转换为int8_t，超出范围时截断
+static int8_t parse_temp(const char *text)
+{
+    int value = atoi(text);
+    if (value > 127) value = 127;
+    if (value < -128) value = -128;
+    return (int8_t)value;
+}
+
+static void convert_daily(const weather_json_daily_t *daily, weather_forecast_t *forecast)
+{
+    memset(forecast, 0, sizeof(*forecast));
+    for (int i = 0; i < daily->count && i < WEATHER_FORECAST_DAYS; i++) {
+        const weather_json_day_t *src = &daily->days[i];
+        weather_forecast_day_t *dst = &forecast->days[i];
+        // 日期格式"YYYY-MM-DD"
+        int year, month, day;
+        if (sscanf(src->date, "%d-%d-%d", &year, &month, &day) == 3) {
+            dst->month = (uint8_t)month;
+            dst->day = (uint8_t)day;
+        }
+        dst->code = src->code_day[0] != '\0' ? (int8_t)atoi(src->code_day) : -1;
+        dst->high = parse_temp(src->high);
+        dst->low = parse_temp(src->low);
+        forecast->count++;
+    }
+}
+
+static bool seniverse_parse_finish(weather_parse_state_t *state, weather_report_t *out)
+{
+    seniverse_state_t *s = (seniverse_state_t *)state->bytes;
+    const weather_now_t *now = &s->now;
+
+    memset(out, 0, sizeof(*out));
+    out->code = -1;
+    if (now->found & WEATHER_JSON_LAST_UPDATE) {
+        snprintf(out->last_update, sizeof(out->last_update), "%s", now->last_update);
+    }
+
+    if (!weather_json_finish(&s->parser)) {
+        // 出错时响应体里的status字段说明原因
+        if (s->parser.error) {
+            snprintf(out->error, sizeof(out->error), "malformed JSON");
+        } else if (now->found & WEATHER_JSON_STATUS) {
+            snprintf(out->error, sizeof(out->error), "%s", now->status);
+        } else {
+            snprintf(out->error, sizeof(out->error), "no weather fields in response");
+        }
+        return false;
+    }
+
+    if (s->req == WEATHER_REQ_DAILY) {
+        convert_daily(&s->daily, &out->forecast);
+    } else {
+        snprintf(out->text, sizeof(out->text), "%s", now->text);
+        snprintf(out->temperature, sizeof(out->temperature), "%s", now->temperature);
+        // 天气现象代码（字符串形式，如"4"）
+        out->code = (now->found & WEATHER_JSON_CODE) ? atoi(now->code) : -1;
+    }
+    return true;
+}
+
+const weather_provider_t weather_provider_seniverse = {
+    .name = "seniverse",
+    .base = SENIVERSE_API_BASE,
+    .build_path = seniverse_build_path,
+    .parse_begin = seniverse_parse_begin,
+    .parse_feed = seniverse_parse_feed,
+    .parse_finish = seniverse_parse_finish,
+    .fetch = NULL,
+};
@@ -0,0 +1,453 @@
+#include "weather_service.h"
+#include "weather.h"
+#include "spsc_ring.h"
+#include "app_cores.h"
+#include "power_mgmt.h"
+#include "loop_monitor.h"
+#include "weather_cache.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static const char *TAG = "WEATHER_SVC";
+
+#define WEATHER_SERVICE_INTERVAL_MS  (5 * 60 * 1000)  // 正常刷新间隔5分钟
+
+// 失败后30秒起指数退避，最长5分钟；连续失败6次或持续20分钟后断路，之后每15分钟探测一次
+static const retry_policy_config_t s_retry_config = {
+    .base_ms = 30 * 1000,
+    .max_ms = 5 * 60 * 1000,
+    .jitter_pct = 20,
+    .open_after = 6,
+    .window_ms = 20 * 60 * 1000,
+    .probe_ms = 15 * 60 * 1000,
+};
+
+#define WEATHER_SERVICE_RING_SIZE    4
+
+// HTTPS的TLS握手（mbedTLS、证书包校验）在这个任务上运行，需要的栈比明文HTTP大得多
+#if CONFIG_WEATHER_USE_HTTPS
+#define WEATHER_SERVICE_STACK_SIZE   8192
+#else
+#define WEATHER_SERVICE_STACK_SIZE   4096
+#endif
+
+static TaskHandle_t s_task = NULL;
+static volatile bool s_fetching = false;
+
+// 重试状态只由网络任务修改，控制台读取时拷贝一份
+static retry_policy_t s_retry;
+static portMUX_TYPE s_retry_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// 堆统计只由网络任务写，读取时不加锁（诊断用，偶尔读到半更新的值无所谓）
+static weather_heap_stats_t s_heap_stats = {0};
+static size_t s_heap_baseline = 0;  // 第一次刷新结束时的空闲堆（句柄和缓冲区已经分配好）
+
+#if CONFIG_WEATHER_HEAP_TRACE
+#include "esp_heap_trace.h"
+#define WEATHER_HEAP_TRACE_RECORDS 64
+static heap_trace_record_t s_heap_records[WEATHER_HEAP_TRACE_RECORDS];
+#endif
+
+// 数据源切换请求：控制台写，天气任务在下一轮刷新开始时切换（传输层状态只在天气任务中修改）
+static const weather_provider_t *volatile s_requested_provider = NULL;
+
+// 取数到上屏的时间线：天气任务记录每轮开始和快照发布，渲染任务记录画完的版本（基准测试用）
+typedef struct {
+    uint32_t cycles;           // 完成的刷新轮数（成功或失败）
+    uint32_t version;          // 最近发布的快照版本
+    int64_t start_us;          // 发布这个版本的那轮刷新开始的时刻
+    int64_t publish_us;        // 快照入队的时刻
+    uint32_t rendered_version; // 渲染任务最近画完的版本
+    int64_t rendered_us;
+} fetch_timing_t;
+
+static fetch_timing_t s_timing = {0};
+static portMUX_TYPE s_timing_lock = portMUX_INITIALIZER_UNLOCKED;
+
+#define WEATHER_BENCH_MAX_RUNS 50
+
+// 网络核心（生产者）到渲染核心（消费者）的快照通道，快照入队后不再修改
+SPSC_RING_DEFINE(s_snapshot_ring, weather_snapshot_t, WEATHER_SERVICE_RING_SIZE);
+static uint32_t s_version = 0;             // 只有网络任务（和任务启动前的weather_service_start）访问
+static weather_snapshot_t s_latest = { .version = 0, .code = -1 }; // 只有渲染任务访问
+static weather_snapshot_t s_current = { .version = 0, .code = -1 }; // 网络任务拼好的最新数据
+
+static void publish_snapshot(weather_snapshot_t *snapshot)
+{
+    snapshot->version = ++s_version;
+
+    // 渲染任务每秒都会取走，正常不会满；满了说明渲染停住了，丢掉这份等下次再发
+    if (!spsc_ring_push(&s_snapshot_ring, snapshot)) {
+        ESP_LOGW(TAG, "Snapshot ring full, dropping weather v%lu", snapshot->version);
+    }
+}
+
+// 实况或预报有一项更新就发布整份快照，另一项沿用上次的数据
+static void publish(bool now_changed, int64_t cycle_start)
+{
+    weather_snapshot_t snapshot = s_current;
+    publish_snapshot(&snapshot);
+
+    portENTER_CRITICAL(&s_timing_lock);
+    s_timing.version = snapshot.version;
+    s_timing.start_us = cycle_start;
+    s_timing.publish_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&s_timing_lock);
+    
+    // 持久化实况（内部限流），下次开机先显示这份；模拟数据源的数据不写
+    if (now_changed && weather_get_provider()->fetch == NULL) {
+        weather_cache_store(&snapshot);
+    }
+}
+
+static void record_heap(size_t free_before)
+{
+    size_t free_after = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    uint32_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+
+    s_heap_stats.cycles++;
+    s_heap_stats.last_delta = (int32_t)free_after - (int32_t)free_before;
+    if (s_heap_baseline == 0) {
+        s_heap_baseline = free_after;
+        s_heap_stats.min_largest_block = largest;
+    }
+    s_heap_stats.drift = (int32_t)free_after - (int32_t)s_heap_baseline;
+    if (largest < s_heap_stats.min_largest_block) {
+        s_heap_stats.min_largest_block = largest;
+    }
+
+    // 栈余量只在变小时打印：第一次完整握手之后基本就稳定了
+    uint32_t stack_free = uxTaskGetStackHighWaterMark(NULL);
+    if (s_heap_stats.stack_free_min == 0 || stack_free < s_heap_stats.stack_free_min) {
+        s_heap_stats.stack_free_min = stack_free;
+        ESP_LOGI(TAG, "Stack high water mark: %lu of %d bytes free", stack_free, WEATHER_SERVICE_STACK_SIZE);
+    }
+}
+
+static void weather_service_task(void *arg)
+{
+    weather_report_t now;
+    weather_report_t daily;
+    TickType_t wait = portMAX_DELAY; // 联网前不请求，等第一次刷新请求
+
+    while (1) {
+        // 等到刷新间隔到期，或者有人请求立即刷新
+        ulTaskNotifyTake(pdTRUE, wait);
+
+        const weather_provider_t *provider = s_requested_provider;
+        if (provider != NULL && provider != weather_get_provider()) {
+            weather_set_provider(provider);
+        }
+        
+        // 断路时这次请求作为探测（主动刷新，例如重新联网，也会立即探测）
+        portENTER_CRITICAL(&s_retry_lock);
+        retry_policy_attempt(&s_retry);
+        portEXIT_CRITICAL(&s_retry_lock);
+
+        // 请求可能要阻塞十几秒，但只阻塞这个任务，渲染循环照常按秒刷新
+        s_fetching = true;
+        power_mgmt_acquire(POWER_LOCK_NET);
+        loop_monitor_busy(LOOP_SUBSYS_WEATHER, true);
+        size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+#if CONFIG_WEATHER_HEAP_TRACE
+        heap_trace_start(HEAP_TRACE_ALL);
+#endif
+        int64_t cycle_start = esp_timer_get_time();
+        weather_fetch_result_t result = weather_fetch(WEATHER_REQ_NOW, &now);
+        // 预报紧接着在同一个长连接上请求，不再建连，整轮耗时接近单次请求
+        weather_fetch_result_t forecast_result = WEATHER_FETCH_FAILED;
+        if (result != WEATHER_FETCH_FAILED) {
+            forecast_result = weather_fetch(WEATHER_REQ_DAILY, &daily);
+        }
+        int64_t cycle_us = esp_timer_get_time() - cycle_start;
+#if CONFIG_WEATHER_HEAP_TRACE
+        heap_trace_stop();
+        // 第一次刷新要创建句柄和缓冲区，之后稳定状态下不应该再有分配
+        if (s_heap_stats.cycles > 0 && heap_trace_get_count() > 0) {
+            ESP_LOGW(TAG, "%u heap allocations during weather refresh", (unsigned)heap_trace_get_count());
+            heap_trace_dump();
+        }
+#endif
+        record_heap(heap_before);
+        loop_monitor_busy(LOOP_SUBSYS_WEATHER, false);
+        power_mgmt_release(POWER_LOCK_NET);
+        s_fetching = false;
+        
+        if (result != WEATHER_FETCH_FAILED) {
+            ESP_LOGI(TAG, "Weather cycle took %lld ms", cycle_us / 1000);
+        }
+        if (forecast_result == WEATHER_FETCH_FAILED && result != WEATHER_FETCH_FAILED) {
+            ESP_LOGW(TAG, "Forecast fetch failed, keeping previous forecast");
+        }
+        
+        if (result == WEATHER_FETCH_UPDATED) {
+            ESP_LOGI(TAG, "Weather updated: %s, %s (code %d)", now.text, now.temperature, now.code);
+            snprintf(s_current.weather, sizeof(s_current.weather), "%s", now.text);
+            snprintf(s_current.temperature, sizeof(s_current.temperature), "%s", now.temperature);
+            s_current.code = now.code;
+            s_current.updated = time(NULL);
+            s_current.stale = false;
+        }
+        if (forecast_result == WEATHER_FETCH_UPDATED) {
+            s_current.forecast = daily.forecast;
+        }
+        
+        if (result != WEATHER_FETCH_FAILED) {
+            portENTER_CRITICAL(&s_retry_lock);
+            retry_state_t prev = s_retry.state;
+            retry_policy_success(&s_retry);
+            portEXIT_CRITICAL(&s_retry_lock);
+            if (prev != RETRY_CLOSED) {
+                ESP_LOGI(TAG, "Weather fetch recovered, circuit closed");
+            }
+        }
+        
+        if (result == WEATHER_FETCH_UPDATED || forecast_result == WEATHER_FETCH_UPDATED) {
+            publish(result == WEATHER_FETCH_UPDATED, cycle_start);
+            wait = pdMS_TO_TICKS(WEATHER_SERVICE_INTERVAL_MS);
+        } else if (result == WEATHER_FETCH_UNCHANGED) {
+            // 数据没变：不发布快照，渲染端也就不会重画天气
+            wait = pdMS_TO_TICKS(WEATHER_SERVICE_INTERVAL_MS);
+        } else {
+            portENTER_CRITICAL(&s_retry_lock);
+            uint32_t delay_ms = retry_policy_failure(&s_retry, esp_timer_get_time());
+            retry_policy_t retry = s_retry;
+            portEXIT_CRITICAL(&s_retry_lock);
+            ESP_LOGW(TAG, "Weather fetch failed (%lu in a row), circuit %s, keeping previous data, retry in %lu s",
+                     retry.consecutive_failures, retry_policy_state_name(retry.state), delay_ms / 1000);
+            wait = pdMS_TO_TICKS(delay_ms);
+        }
+
+        // 限流期间没写进NVS的最新实况，间隔到期后在这里补写（数据不变时不会再有store调用）
+        weather_cache_flush();
+
+        portENTER_CRITICAL(&s_timing_lock);
+        s_timing.cycles++;
+        portEXIT_CRITICAL(&s_timing_lock);
+    }
+}
+
+esp_err_t weather_service_start(void)
+{
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    // 服务器地址只在这里解析一次，之后联网事件、对时任务读到的主机名不会再变
+    weather_init();
+    retry_policy_init(&s_retry, &s_retry_config);
+#if CONFIG_WEATHER_HEAP_TRACE
+    ESP_ERROR_CHECK(heap_trace_init_standalone(s_heap_records, WEATHER_HEAP_TRACE_RECORDS));
+#endif
+    
+    // 先发布NVS中的缓存，屏幕不用等联网就能显示天气
+    weather_snapshot_t cached;
+    if (weather_cache_load(&cached) == ESP_OK) {
+        // 缓存也作为网络任务的起点：第一轮只更新预报时，发布的快照里仍是缓存的实况
+        s_current = cached;
+        publish_snapshot(&cached);
+    }
+
+    // 固定在网络核心上，HTTP请求和JSON解析不会挤占渲染核心
+    if (xTaskCreatePinnedToCore(weather_service_task, "weather_net", WEATHER_SERVICE_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1,
+                                &s_task, APP_CORE_NET) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create weather task");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void weather_service_request_refresh(void)
+{
+    if (s_task != NULL) {
+        xTaskNotifyGive(s_task);
+    }
+}
+
+bool weather_service_get(weather_snapshot_t *out, uint32_t *seen_version)
+{
+    if (out == NULL || seen_version == NULL) {
+        return false;
+    }
+
+    // 取走通道里的所有快照，只保留最新的一份
+    weather_snapshot_t snapshot;
+    while (spsc_ring_pop(&s_snapshot_ring, &snapshot)) {
+        s_latest = snapshot;
+    }
+
+    if (s_latest.version == *seen_version) {
+        return false;
+    }
+    *out = s_latest;
+    *seen_version = s_latest.version;
+    return true;
+}
+
+void weather_service_get_heap_stats(weather_heap_stats_t *out)
+{
+    if (out != NULL) {
+        *out = s_heap_stats;
+    }
+}
+
+void weather_service_get_retry(retry_policy_t *out)
+{
+    if (out == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_retry_lock);
+    *out = s_retry;
+    portEXIT_CRITICAL(&s_retry_lock);
+}
+
+bool weather_service_busy(void)
+{
+    return s_fetching;
+}
+
+void weather_service_mark_rendered(uint32_t version)
+{
+    portENTER_CRITICAL(&s_timing_lock);
+    s_timing.rendered_version = version;
+    s_timing.rendered_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&s_timing_lock);
+}
+
+static fetch_timing_t get_timing(void)
+{
+    portENTER_CRITICAL(&s_timing_lock);
+    fetch_timing_t timing = s_timing;
+    portEXIT_CRITICAL(&s_timing_lock);
+    return timing;
+}
+
+// 轮询等待条件成立，超时返回false
+static bool wait_timing(fetch_timing_t *timing, bool (*done)(const fetch_timing_t *, const fetch_timing_t *),
+                        const fetch_timing_t *before, int64_t deadline)
+{
+    while (esp_timer_get_time() < deadline) {
+        *timing = get_timing();
+        if (done(timing, before)) {
+            return true;
+        }
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    return false;
+}
+
+static bool cycle_done(const fetch_timing_t *now, const fetch_timing_t *before)
+{
+    return now->cycles != before->cycles;
+}
+
+static bool version_rendered(const fetch_timing_t *now, const fetch_timing_t *before)
+{
+    return now->rendered_version == now->version;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+// 输出一组样本的最小/平均/中位/最大值（会排序samples）
+static void print_summary(FILE *out, const char *label, uint32_t *samples, int count)
+{
+    if (count == 0) {
+        return;
+    }
+    uint64_t sum = 0;
+    for (int i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+    qsort(samples, count, sizeof(samples[0]), compare_u32);
+    fprintf(out, "%-14s min %7lu  avg %7lu  p50 %7lu  max %7lu ms\n", label,
+            samples[0] / 1000, (uint32_t)(sum / count) / 1000, samples[count / 2] / 1000,
+            samples[count - 1] / 1000);
+}
+
+esp_err_t weather_service_bench(const weather_provider_t *provider, int runs, FILE *out)
+{
+    if (s_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (provider == NULL || runs <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (runs > WEATHER_BENCH_MAX_RUNS) {
+        runs = WEATHER_BENCH_MAX_RUNS;
+    }
+
+    // 每个样本：一轮刷新（实况+预报）耗时、发布到渲染画完的等待、合计
+    uint32_t fetch_us[WEATHER_BENCH_MAX_RUNS];
+    uint32_t render_us[WEATHER_BENCH_MAX_RUNS];
+    uint32_t total_us[WEATHER_BENCH_MAX_RUNS];
+    int samples = 0;
+    int failed = 0;
+
+    const weather_provider_t *prev = weather_get_provider();
+    s_requested_provider = provider;
+    weather_set_force_refresh(true);
+
+    // 等正在进行的刷新结束，免得把它算进第一个样本
+    while (s_fetching) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
+    fprintf(out, "weather bench: provider %s, %d runs\n", provider->name, runs);
+    int64_t bench_start = esp_timer_get_time();
+    for (int i = 0; i < runs; i++) {
+        fetch_timing_t before = get_timing();
+        fetch_timing_t timing;
+        // 超时比HTTP客户端的超时（两个请求各15秒）稍长
+        int64_t deadline = esp_timer_get_time() + 40 * 1000 * 1000;
+
+        weather_service_request_refresh();
+        if (!wait_timing(&timing, cycle_done, &before, deadline)) {
+            fprintf(out, "run %d: no response, aborting\n", i + 1);
+            failed++;
+            break;
+        }
+        if (timing.version == before.version) {
+            fprintf(out, "run %d: fetch failed\n", i + 1);
+            failed++;
+            continue;
+        }
+        if (!wait_timing(&timing, version_rendered, &before, deadline)) {
+            fprintf(out, "run %d: v%lu not rendered\n", i + 1, timing.version);
+            failed++;
+            continue;
+        }
+
+        fetch_us[samples] = (uint32_t)(timing.publish_us - timing.start_us);
+        render_us[samples] = (uint32_t)(timing.rendered_us - timing.publish_us);
+        total_us[samples] = (uint32_t)(timing.rendered_us - timing.start_us);
+        fprintf(out, "run %d: v%lu fetch %lu ms, publish->render %lu ms, total %lu ms\n", i + 1,
+                timing.version, fetch_us[samples] / 1000, render_us[samples] / 1000, total_us[samples] / 1000);
+        samples++;
+    }
+    int64_t elapsed_us = esp_timer_get_time() - bench_start;
+
+    // 恢复原数据源，立即刷新一次换回真实数据
+    s_requested_provider = prev;
+    weather_set_force_refresh(false);
+    weather_service_request_refresh();
+
+    fprintf(out, "%d ok, %d failed in %lld ms\n", samples, failed, elapsed_us / 1000);
+    print_summary(out, "fetch", fetch_us, samples);
+    print_summary(out, "publish->draw", render_us, samples);
+    print_summary(out, "fetch->draw", total_us, samples);
+    if (samples > 0 && elapsed_us > 0) {
+        fprintf(out, "throughput %lu refreshes/min\n", (uint32_t)((int64_t)samples * 60 * 1000000 / elapsed_us));
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,58 @@
+#ifndef WEATHER_SERVICE_H
+#define WEATHER_SERVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+#include "esp_err.h"
+#include "weather.h"
+#include "retry_policy.h"
+
+// 天气快照：网络任务发布，渲染循环无阻塞读取
+typedef struct {
+    uint32_t version;        // 每发布一次加1，0表示还没有数据
+    char weather[32];        // 天气文字
+    char temperature[8];     // 温度
+    int code;                // 心知天气现象代码，-1表示未知
+    time_t updated;          // 获取成功的时间
+    bool stale;              // 来自开机时读取的过期缓存，拿到新数据前显示为过期
+    weather_forecast_t forecast; // 逐日预报，count为0表示还没有
+} weather_snapshot_t;
+
+// 启动天气网络任务（所有天气请求都在这个任务中完成）
+esp_err_t weather_service_start(void);
+
+// 请求立即刷新一次（例如联网或时间同步完成后），不等待结果
+void weather_service_request_refresh(void);
+
+// 读取最新快照，版本号与*seen_version不同时返回true并更新*seen_version，不会阻塞
+// （快照通过无锁SPSC队列传递，只能由渲染流程这一个消费者调用）
+bool weather_service_get(weather_snapshot_t *out, uint32_t *seen_version);
+
+// 刷新前后的内存统计：其他任务同时也在分配，单次的差值只是近似，长时间看drift和最大空闲块的趋势
+typedef struct {
+    uint32_t cycles;            // 统计过的刷新次数
+    int32_t last_delta;         // 最近一次刷新前后空闲堆的变化（负数表示少了）
+    int32_t drift;              // 相对第一次刷新结束时空闲堆的变化，稳定运行时应在0附近
+    uint32_t min_largest_block; // 刷新结束时最大空闲块的最小值，碎片化时会越来越小
+    uint32_t stack_free_min;    // 天气任务栈的历史最小剩余（字节），HTTPS握手后就是实际余量
+} weather_heap_stats_t;
+
+void weather_service_get_heap_stats(weather_heap_stats_t *out);
+
+// 读取失败重试和断路器的当前状态（诊断用）
+void weather_service_get_retry(retry_policy_t *out);
+
+// 是否正在进行天气请求（用于统计网络繁忙时的渲染抖动）
+bool weather_service_busy(void);
+
+// 渲染任务画完某个版本的快照后调用（用于统计取数到上屏的延迟）
+void weather_service_mark_rendered(uint32_t version);
+
+// 基准测试：临时切换到provider，强制刷新runs次（最多50次），每次等到渲染任务画完，
+// 输出每轮取数耗时、发布到上屏的等待、取数到上屏的总延迟和吞吐；结束后恢复原数据源。
+// 会阻塞调用者直到测试结束（在控制台任务中调用）
+esp_err_t weather_service_bench(const weather_provider_t *provider, int runs, FILE *out);
+
+#endif
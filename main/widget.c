@@ -0,0 +1,231 @@
+#include "widget.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "trace.h"
+#include "freertos/FreeRTOS.h"
+#include <string.h>
+
+static const char *TAG = "WIDGET";
+
+#define WIDGET_MAX 12
+#define FNV_PRIME 16777619u
+
+static widget_t *s_widgets[WIDGET_MAX];
+static int s_count = 0;
+
+static volatile bool s_frame_active = false;
+static volatile bool s_invalidate_all = false; // 其他任务请求的全部重绘，下一帧开始时生效
+static widget_frame_stats_t s_frame_stats = {0};
+static uint64_t s_frame_total_us = 0;
+
+// 提交队列：每个控件一个槽位，生产者可能在另一个核心上
+static portMUX_TYPE s_queue_lock = portMUX_INITIALIZER_UNLOCKED;
+static widget_queue_stats_t s_queue_stats = {0};
+
+uint32_t widget_hash(uint32_t h, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ p[i]) * FNV_PRIME;
+    }
+    return h;
+}
+
+uint32_t widget_hash_str(uint32_t h, const char *str)
+{
+    if (str == NULL) {
+        return h;
+    }
+    // 带上结束符，避免"ab"+"c"与"a"+"bc"指纹相同
+    return widget_hash(h, str, strlen(str) + 1);
+}
+
+uint32_t widget_hash_int(uint32_t h, int value)
+{
+    return widget_hash(h, &value, sizeof(value));
+}
+
+esp_err_t widget_register(widget_t *w)
+{
+    if (w == NULL || w->render == NULL || (w->fingerprint == NULL && w->value == NULL) ||
+        (w->value != NULL && (w->pending == NULL || w->value_size == 0))) {
+        ESP_LOGE(TAG, "Invalid widget");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_count >= WIDGET_MAX) {
+        ESP_LOGE(TAG, "Too many widgets, cannot register %s", w->name ? w->name : "?");
+        return ESP_ERR_NO_MEM;
+    }
+
+    w->dirty = true;
+    w->last_fp = 0;
+    w->cost_us = 0;
+    w->queued = false;
+    w->deferred = false;
+
+    // 按优先级插入，同优先级保持注册顺序
+    int pos = s_count;
+    while (pos > 0 && s_widgets[pos - 1]->prio > w->prio) {
+        s_widgets[pos] = s_widgets[pos - 1];
+        pos--;
+    }
+    s_widgets[pos] = w;
+    s_count++;
+    return ESP_OK;
+}
+
+esp_err_t widget_submit(widget_t *w, const void *value)
+{
+    if (w == NULL || w->pending == NULL || value == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // pending取走后不清空，始终是最近一次提交的值：和它相同的重复提交直接忽略，不计入统计
+    portENTER_CRITICAL(&s_queue_lock);
+    if (memcmp(w->pending, value, w->value_size) != 0) {
+        if (w->queued) {
+            s_queue_stats.coalesced++;
+        }
+        memcpy(w->pending, value, w->value_size);
+        w->queued = true;
+        s_queue_stats.submitted++;
+    }
+    portEXIT_CRITICAL(&s_queue_lock);
+    return ESP_OK;
+}
+
+// 取走各控件排队的最新值；控件上一帧被顺延时，它还没画出来的值在这里被不同的新值覆盖
+static void drain_queue(void)
+{
+    for (int i = 0; i < s_count; i++) {
+        widget_t *w = s_widgets[i];
+        if (!w->queued) {
+            continue;
+        }
+        portENTER_CRITICAL(&s_queue_lock);
+        if (w->deferred && memcmp(w->value, w->pending, w->value_size) != 0) {
+            s_queue_stats.coalesced++;
+        }
+        memcpy(w->value, w->pending, w->value_size);
+        w->queued = false;
+        portEXIT_CRITICAL(&s_queue_lock);
+    }
+}
+
+static uint32_t fingerprint_of(const widget_t *w)
+{
+    if (w->fingerprint) {
+        return w->fingerprint(w);
+    }
+    return widget_hash(WIDGET_HASH_INIT, w->value, w->value_size);
+}
+
+void widget_invalidate(widget_t *w)
+{
+    if (w) {
+        w->dirty = true;
+    }
+}
+
+void widget_invalidate_all(void)
+{
+    // 只设置标志，由渲染任务在下一帧开始时标记，不会和正在进行的绘制互相覆盖dirty
+    s_invalidate_all = true;
+}
+
+void widget_invalidate_rect(const lcd_rect_t *rect)
+{
+    if (rect == NULL) return;
+
+    for (int i = 0; i < s_count; i++) {
+        const lcd_rect_t *r = &s_widgets[i]->region;
+        if (r->x < rect->x + rect->width && rect->x < r->x + r->width &&
+            r->y < rect->y + rect->height && rect->y < r->y + r->height) {
+            s_widgets[i]->dirty = true;
+        }
+    }
+}
+
+int widget_update(lcd_display_t *lcd, uint32_t budget_us)
+{
+    int rendered = 0;
+    int deferred = 0;
+    int64_t start = esp_timer_get_time();
+
+    s_frame_active = true;
+    drain_queue();
+    if (s_invalidate_all) {
+        s_invalidate_all = false;
+        for (int i = 0; i < s_count; i++) {
+            s_widgets[i]->dirty = true;
+        }
+    }
+
+    for (int i = 0; i < s_count; i++) {
+        widget_t *w = s_widgets[i];
+        uint32_t fp = fingerprint_of(w);
+        if (!w->dirty && fp == w->last_fp) {
+            continue;
+        }
+
+        // 高优先级必画；其余控件在预计超出预算时顺延（本帧什么都没画时照画，保证不会饿死）
+        uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+        if (w->prio != WIDGET_PRIO_HIGH && rendered > 0 && elapsed + w->cost_us > budget_us) {
+            w->dirty = true;
+            w->deferred = true;
+            deferred++;
+            continue;
+        }
+
+        int64_t t0 = esp_timer_get_time();
+        if (w->bg) {
+            lcd_restore_text_area_bg(lcd, w->bg);
+        }
+        w->render(lcd, w);
+        uint32_t cost = (uint32_t)(esp_timer_get_time() - t0);
+        w->cost_us = w->cost_us ? (w->cost_us * 3 + cost) / 4 : cost;
+        // 控件名是字符串常量，记录其地址，解码时再取名字
+        TRACE(TRACE_EV_WIDGET_RENDER, TRACE_U16(cost), (uint32_t)(uintptr_t)w->name, fp);
+        w->last_fp = fp;
+        w->dirty = false;
+        w->deferred = false;
+        rendered++;
+    }
+    s_queue_stats.executed += rendered;
+
+    s_frame_active = false;
+
+    if (rendered > 0) {
+        uint32_t frame_us = (uint32_t)(esp_timer_get_time() - start);
+        s_frame_stats.frames++;
+        s_frame_total_us += frame_us;
+        s_frame_stats.avg_frame_us = s_frame_total_us / s_frame_stats.frames;
+        if (frame_us > s_frame_stats.max_frame_us) s_frame_stats.max_frame_us = frame_us;
+        if (frame_us > budget_us) s_frame_stats.over_budget++;
+        TRACE(TRACE_EV_FRAME, TRACE_U16(rendered), deferred, frame_us);
+    }
+    s_frame_stats.deferred += deferred;
+
+    return deferred;
+}
+
+bool widget_frame_in_progress(void)
+{
+    return s_frame_active;
+}
+
+void widget_get_frame_stats(widget_frame_stats_t *stats)
+{
+    if (stats) {
+        *stats = s_frame_stats;
+    }
+}
+
+void widget_get_queue_stats(widget_queue_stats_t *stats)
+{
+    if (stats) {
+        portENTER_CRITICAL(&s_queue_lock);
+        *stats = s_queue_stats;
+        portEXIT_CRITICAL(&s_queue_lock);
+    }
+}
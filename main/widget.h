@@ -0,0 +1,93 @@
+#ifndef WIDGET_H
+#define WIDGET_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "lcd_driver.h"
+
+typedef struct widget widget_t;
+
+// 控件优先级：高优先级每帧必画，低优先级在时间预算用完时顺延到后面的帧
+typedef enum {
+    WIDGET_PRIO_HIGH = 0,    // 秒、分、时
+    WIDGET_PRIO_NORMAL,      // 日期
+    WIDGET_PRIO_LOW,         // 天气、地址等
+} widget_prio_t;
+
+// 帧统计
+typedef struct {
+    uint32_t frames;         // 有重绘的帧数
+    uint32_t avg_frame_us;   // 平均每帧绘制耗时
+    uint32_t max_frame_us;   // 最大每帧绘制耗时
+    uint32_t deferred;       // 累计顺延的控件次数
+    uint32_t over_budget;    // 超出预算的帧数（高优先级控件本身超时）
+} widget_frame_stats_t;
+
+// 提交队列统计
+typedef struct {
+    uint32_t submitted;      // 值有变化的提交次数（和上次提交相同的不算）
+    uint32_t coalesced;      // 还没绘制就被不同的新值覆盖掉的次数（排队中被覆盖，或控件被顺延期间来了新值）
+    uint32_t executed;       // 实际执行的绘制次数
+} widget_queue_stats_t;
+
+// 计算当前显示值的指纹（要便宜，每帧都会调用）
+typedef uint32_t (*widget_fingerprint_fn)(const widget_t *w);
+// 绘制控件（背景已经恢复好）
+typedef void (*widget_render_fn)(lcd_display_t *lcd, const widget_t *w);
+
+// 控件：屏幕区域 + 值指纹 + 绘制回调；
+// 通过widget_submit提交值的控件还要提供value/pending两块value_size大小的缓冲区
+struct widget {
+    const char *name;
+    widget_prio_t prio;
+    lcd_rect_t region;               // 控件占用的屏幕区域
+    text_area_bg_t *bg;              // 绘制前恢复的背景，NULL表示由render自己处理
+    widget_fingerprint_fn fingerprint; // NULL表示对value整块取指纹
+    widget_render_fn render;
+    void *ctx;                       // 控件自己的数据
+    void *value;                     // 绘制用的值（只在渲染任务中访问）
+    void *pending;                   // 最近一次提交的值（取走后保留，用于忽略重复提交）
+    size_t value_size;
+    bool queued;                     // pending中有未取走的值
+    uint32_t last_fp;                // 上次绘制时的指纹
+    bool dirty;                      // 被强制标记需要重绘
+    bool deferred;                   // value已取走但因预算不足还没画出来（只在渲染任务中访问）
+    uint32_t cost_us;                // 绘制耗时估计（滑动平均）
+};
+
+// 指纹计算（FNV-1a）
+#define WIDGET_HASH_INIT 2166136261u
+uint32_t widget_hash(uint32_t h, const void *data, size_t len);
+uint32_t widget_hash_str(uint32_t h, const char *str);
+uint32_t widget_hash_int(uint32_t h, int value);
+
+// 注册控件（按优先级排序，注册后第一帧一定会绘制）
+esp_err_t widget_register(widget_t *w);
+
+// 提交控件的新值（任意任务），同一控件每次只排一个：还没被取走的旧值直接被覆盖，
+// 显示永远只画最新值，队列不会积压；和上次提交相同的值被忽略
+esp_err_t widget_submit(widget_t *w, const void *value);
+
+// 标记控件需要重绘
+void widget_invalidate(widget_t *w);
+// 全部重绘（任意任务，下一帧生效；例如整屏背景被基准测试重画之后）
+void widget_invalidate_all(void);
+// 标记与指定区域相交的控件需要重绘（区域被其他绘制覆盖后调用）
+void widget_invalidate_rect(const lcd_rect_t *rect);
+
+// 按优先级重绘指纹变化或被标记的控件，budget_us为本帧时间预算，
+// 返回因预算不足顺延的控件数（只在渲染任务中调用）
+int widget_update(lcd_display_t *lcd, uint32_t budget_us);
+
+// 渲染帧正在进行（动画等后台绘制在此期间让路）
+bool widget_frame_in_progress(void);
+
+// 获取帧统计
+void widget_get_frame_stats(widget_frame_stats_t *stats);
+
+// 获取提交队列统计
+void widget_get_queue_stats(widget_queue_stats_t *stats);
+
+#endif